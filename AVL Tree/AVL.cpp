@@ -9,6 +9,9 @@
  * 
  */
 
+#ifndef AVL_CPP_
+#define AVL_CPP_
+
 #include "AVL.h"
 #include <iostream>
 #include <stack>
@@ -17,22 +20,72 @@
 
 using namespace std;
 
+//hint that a node will be read soon, a no-op on compilers without the
+//builtin
+#ifndef TREE_PREFETCH
+#if defined(__GNUC__) || defined(__clang__)
+#define TREE_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define TREE_PREFETCH(address)
+#endif
+#endif
+
 //default constructor
 //Parameters: Nothing
 //Returns: Nothing
 //Does: Initializes an instance of the Class
-template<typename ElemType>
-AVL<ElemType>::AVL()
+template<typename ElemType, typename Compare, typename StatsPolicy>
+AVL<ElemType, Compare, StatsPolicy>::AVL()
+{
+        root = nullptr;
+        weak = false;
+}
+
+//comparator constructor
+//Parameters: const Compare &comp - the comparator used to order elements
+//Returns: Nothing
+//Does: Initializes an empty instance of the Class that orders its
+//      elements with the passed in comparator
+template<typename ElemType, typename Compare, typename StatsPolicy>
+AVL<ElemType, Compare, StatsPolicy>::AVL(const Compare &comp)
 {
         root = nullptr;
+        weak = false;
+        compare = comp;
+}
+
+//balance mode constructor
+//Parameters: AVLBalance mode - HEIGHT_BALANCED or RANK_BALANCED
+//Returns: Nothing
+//Does: Initializes an empty instance of the Class using the given
+//      balancing rule
+template<typename ElemType, typename Compare, typename StatsPolicy>
+AVL<ElemType, Compare, StatsPolicy>::AVL(AVLBalance mode)
+{
+        root = nullptr;
+        weak = (mode == RANK_BALANCED);
+}
+
+//comparator and balance mode constructor
+//Parameters: const Compare &comp - the comparator used to order elements
+//            AVLBalance mode - HEIGHT_BALANCED or RANK_BALANCED
+//Returns: Nothing
+//Does: Initializes an empty instance of the Class ordered by comp and
+//      using the given balancing rule
+template<typename ElemType, typename Compare, typename StatsPolicy>
+AVL<ElemType, Compare, StatsPolicy>::AVL(const Compare &comp, AVLBalance mode)
+{
+        root = nullptr;
+        weak = (mode == RANK_BALANCED);
+        compare = comp;
 }
 
 //destructor
 //Parameters: Nothing
 //Returns: Nothing
 //Does: Deletes all dynamically allocated memory
-template<typename ElemType>
-AVL<ElemType>::~AVL()
+template<typename ElemType, typename Compare, typename StatsPolicy>
+AVL<ElemType, Compare, StatsPolicy>::~AVL()
 {
         delete_tree(root);
 }
@@ -43,25 +96,29 @@ AVL<ElemType>::~AVL()
 //Returns: Nothing
 //Does: Takes in an instance of the AVL class and makes a 
 //      deep copy of the instance 
-template<typename ElemType>
-AVL<ElemType>::AVL(const AVL &rhs)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+AVL<ElemType, Compare, StatsPolicy>::AVL(const AVL &rhs)
 {
+        compare = rhs.compare;
+        weak = rhs.weak;
         root = copy_tree(rhs.root);
 }
 
 //assignment operator
 //Parameters: const AVL &rhs, the tree that is being copied 
 //            into the current instance
-//Returns: AVL<ElemType>, the object that copied all data
+//Returns: AVL<ElemType, Compare, StatsPolicy>, the object that copied all data
 //         from the source passed into the function
 //Does: Copes the tree passed into the function into the
 //      current instance of the class
-template<typename ElemType>
-AVL<ElemType> &AVL<ElemType>::operator=(const AVL &rhs)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+AVL<ElemType, Compare, StatsPolicy> &AVL<ElemType, Compare, StatsPolicy>::operator=(const AVL &rhs)
 {
         if (this != &rhs) 
         {
                 delete_tree(root);
+                compare = rhs.compare;
+                weak = rhs.weak;
                 root = copy_tree(rhs.root);
         }
         return *this;
@@ -73,8 +130,8 @@ AVL<ElemType> &AVL<ElemType>::operator=(const AVL &rhs)
 //Returns: Nothing
 //Does: Using a post-order traversal, deletes all nodes 
 //      stored in the tree
-template<typename ElemType>
-void AVL<ElemType>::delete_tree(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void AVL<ElemType, Compare, StatsPolicy>::delete_tree(Node *node)
 {
         if (node == nullptr) 
         {
@@ -93,8 +150,8 @@ void AVL<ElemType>::delete_tree(Node *node)
 //         copied
 //Does: Makes a deep copy of the tree beginning at the passed in
 //      node
-template<typename ElemType>
-typename AVL<ElemType>::Node *AVL<ElemType>::copy_tree(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename AVL<ElemType, Compare, StatsPolicy>::Node *AVL<ElemType, Compare, StatsPolicy>::copy_tree(Node *node)
 {
         if (node != nullptr) 
         {
@@ -105,162 +162,517 @@ typename AVL<ElemType>::Node *AVL<ElemType>::copy_tree(Node *node)
                 temp_node->height = node->height;
                 temp_node->left = copy_tree(node->left);
                 temp_node->right = copy_tree(node->right);
+                return temp_node;
         }
-        return node;
+        return nullptr;
 }
 
 //contains Function 
-//Paramters: ElemType element - the value being checked for
+//Paramters: const ElemType &element - the value being checked for
 //Returns: bool - whether or not the value is stored in the tree
 //Does: Checks if a passed in value is stored within the tree 
-template<typename ElemType>
-bool AVL<ElemType>::contains(ElemType element)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+bool AVL<ElemType, Compare, StatsPolicy>::contains(const ElemType &element)
 {
-        return contains_recur(root, element);
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        return find_node(element) != nullptr;
 }
 
-//contains_recur Function (private)
-//Parameters: Node *node - the root of the current tree being checked 
-//            ElemType element - the value being checked for 
-//Returns: bool - whether or not the value is stored in the tree 
-//Does: Checks, recursively, if a value is stored in the tree 
-template<typename ElemType>
-bool AVL<ElemType>::contains_recur(Node *node, ElemType element)
+//contains Function (heterogeneous)
+//Parameters: const Key &key - a value comparable with ElemType
+//Returns: bool - whether or not an equal value is stored in the tree
+//Does: Looks up a key of another type (for example a string_view in a
+//      tree of strings) without constructing an ElemType. Only enabled
+//      when Compare declares is_transparent
+template<typename ElemType, typename Compare, typename StatsPolicy>
+template<typename Key, typename C, typename>
+bool AVL<ElemType, Compare, StatsPolicy>::contains(const Key &key)
 {
-        if (node == nullptr) 
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        return find_node(key) != nullptr;
+}
+
+//contains_batch function
+//Parameters: const ElemType *keys - the values being checked for
+//            int n - the number of keys
+//            bool *out - n flags, out[i] is set to whether keys[i] is
+//                        stored in the tree
+//Returns: Nothing
+//Does: Looks up every key, overlapping the cache misses of many
+//      descents (see lookup_batch)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void AVL<ElemType, Compare, StatsPolicy>::contains_batch(const ElemType *keys, int n, bool *out)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        lookup_batch(keys, n, out);
+}
+
+//contains_batch function (counting)
+//Parameters: const ElemType *keys - the values being checked for
+//            int n - the number of keys
+//Returns: int - how many of the keys are stored in the tree
+//Does: Same as the flag version without writing per key results
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int AVL<ElemType, Compare, StatsPolicy>::contains_batch(const ElemType *keys, int n)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        return lookup_batch(keys, n, nullptr);
+}
+
+//lookup_batch function (private)
+//Parameters: const ElemType *keys - the values being checked for
+//            int n - the number of keys
+//            bool *out - per key results, or nullptr to only count
+//Returns: int - how many of the keys were found
+//Does: Keeps BATCH_LANES descents going at once and moves each of them
+//      one level per round. The child a lane moves to is prefetched and
+//      only read a full round later, so the misses of the different
+//      lanes overlap instead of each level of each lookup stalling on
+//      its own. A finished lane immediately starts the next key
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int AVL<ElemType, Compare, StatsPolicy>::lookup_batch(const ElemType *keys, int n, bool *out)
+{
+        int lane_key[BATCH_LANES];
+        Node *lane_node[BATCH_LANES];
+        int active = 0;
+        int next_key = 0;
+        int found = 0;
+        while (active < BATCH_LANES and next_key < n)
         {
-                return false;
+                lane_key[active] = next_key;
+                lane_node[active] = root;
+                active++;
+                next_key++;
         }
-        if (node->data == element) 
+        while (active > 0)
         {
-                return true;
+                int lane = 0;
+                while (lane < active)
+                {
+                        Node *node = lane_node[lane];
+                        int cmp = 1;
+                        if (node != nullptr)
+                        {
+                                StatsPolicy::node_visit();
+                                cmp = compare_keys(keys[lane_key[lane]], node->data);
+                                node = (cmp < 0) ? node->left : node->right;
+                        }
+                        if (cmp != 0 and node != nullptr)
+                        {
+                                TREE_PREFETCH(node);
+                                lane_node[lane] = node;
+                                lane++;
+                                continue;
+                        }
+                        if (cmp == 0)
+                        {
+                                found++;
+                        }
+                        if (out != nullptr)
+                        {
+                                out[lane_key[lane]] = (cmp == 0);
+                        }
+                        if (next_key < n)
+                        {
+                                lane_key[lane] = next_key;
+                                lane_node[lane] = root;
+                                next_key++;
+                                lane++;
+                        }
+                        else
+                        {
+                                active--;
+                                lane_key[lane] = lane_key[active];
+                                lane_node[lane] = lane_node[active];
+                        }
+                }
         }
-        if (node->data < element)
+        return found;
+}
+
+//find_node Function (private)
+//Parameters: const Key &key - the value being looked for
+//Returns: Node - the node storing an equal value, nullptr if none
+//Does: Walks down from the root making a single three way comparison
+//      at each node
+template<typename ElemType, typename Compare, typename StatsPolicy>
+template<typename Key>
+typename AVL<ElemType, Compare, StatsPolicy>::Node *AVL<ElemType, Compare, StatsPolicy>::find_node(const Key &key)
+{
+        Node *node = root;
+        while (node != nullptr)
         {
-                return contains_recur(node->left, element);
+                StatsPolicy::node_visit();
+                int cmp = compare_keys(key, node->data);
+                if (cmp == 0)
+                {
+                        return node;
+                }
+                node = (cmp < 0) ? node->left : node->right;
         }
-        return contains_recur(node->right, element);
+        return nullptr;
 }
 
 //insert Function 
 //Parameters: ElemType element - the value that is being stored in the tree 
-//Returns: Nothing 
-//Does: Inserts an element into the tree 
-template<typename ElemType>
-void AVL<ElemType>::insert(ElemType element) 
+//Returns: bool - true if a new node was added, false if the value was
+//         already stored and its count was increased instead
+//Does: Stores the value, counting duplicates
+template<typename ElemType, typename Compare, typename StatsPolicy>
+bool AVL<ElemType, Compare, StatsPolicy>::insert(ElemType element)
 {
-        root = insert_recur(root, element);
+        return insert_node(element, true);
 }
 
-//insert_recur Function (private)
-//Parameters: Node *node - the root of the current tree being inserted 
-//                         into
-//            ElemType element - the value being inserted into the tree
-//Returns: Nothing 
-//Does: inserts the value into the tree recursively
-template<typename ElemType>
-typename AVL<ElemType>::Node *AVL<ElemType>::insert_recur(Node *node, ElemType element)
+//insert_unique Function
+//Parameters: ElemType element - the value that is being stored in the tree
+//Returns: bool - true if the value was added, false if it was already
+//         stored
+//Does: Stores the value unless an equal one is already there, in which
+//      case the tree (including the count) is left as it is. Lets a
+//      caller with set semantics add and test in a single descent
+template<typename ElemType, typename Compare, typename StatsPolicy>
+bool AVL<ElemType, Compare, StatsPolicy>::insert_unique(ElemType element)
 {
-        if (node == nullptr)
-        {
-                return new_node(element, 0, 1, nullptr, nullptr);
-        }
-        else if (element < node->data)
-        {
-                node->left = insert_recur(node->left, element);
-        }
-        else if (element > node->data)
+        return insert_node(element, false);
+}
+
+//insert_node Function (private)
+//Parameters: ElemType element - the value that is being stored in the tree
+//            bool count_duplicate - whether an equal value already stored
+//            has its count increased
+//Returns: bool - true if a new node was added
+//Does: Walks down recording the link to each node on the path, hangs a
+//      new leaf at the bottom (or counts a duplicate), then retraces the
+//      path bottom-up fixing heights and balance. Retracing stops at the
+//      first subtree whose height comes out unchanged, which is always
+//      the case right after a rotation, so only the ancestors whose
+//      height really grew are touched
+template<typename ElemType, typename Compare, typename StatsPolicy>
+bool AVL<ElemType, Compare, StatsPolicy>::insert_node(ElemType element, bool count_duplicate)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
+        path.clear();
+        Node **link = &root;
+        while (*link != nullptr)
         {
-                node->right = insert_recur(node->right, element);
+                Node *node = *link;
+                StatsPolicy::node_visit();
+                int cmp = compare_keys(element, node->data);
+                if (cmp == 0)
+                {
+                        if (count_duplicate)
+                        {
+                                node->count++;
+                        }
+                        return false;
+                }
+                path.push_back(link);
+                link = (cmp < 0) ? &node->left : &node->right;
         }
-        else
+        *link = new_node(element, 0, 1, nullptr, nullptr);
+        for (int i = (int)path.size() - 1; i >= 0; i--)
         {
-                node->count++;
-                return node;
+                Node *node = *path[i];
+                int old_height = node->height;
+                if (weak)
+                {
+                        node = weak_insert_fix(node);
+                }
+                else
+                {
+                        node->height = 1 + max(node_height(node->left), node_height(node->right));
+                        node = balance(node);
+                }
+                *path[i] = node;
+                if (node->height == old_height)
+                {
+                        break;
+                }
         }
-        node->height = 1 + max(node_height(node->left), node_height(node->right));
-        node = balance(node);
-
-        return node;
+        return true;
 }
 
 //remove function
 //Parameters: ElemType element - value being removed from the AVL Tree
-//Returns: Nothing
-//Does: Removes a passed in element from the tree
-template<typename ElemType>
-void AVL<ElemType>::remove(ElemType element)
+//Returns: bool - true if the value was stored and has been removed
+//Does: Walks down recording the link to each node on the path. A node
+//      with two children takes over its successor's value and count, and
+//      the successor is unlinked instead, so the node actually removed
+//      always has at most one child. The path is then retraced bottom-up
+//      like in insert: a link is only written when a rotation gives the
+//      subtree a new root, and retracing stops at the first subtree whose
+//      height (or rank) comes out unchanged
+template<typename ElemType, typename Compare, typename StatsPolicy>
+bool AVL<ElemType, Compare, StatsPolicy>::remove(ElemType element)
 {
-        root = remove_recur(root, element);
-}
-
-//remove_recur function (Private)
-//Parameters: Node *node - the root of the tree being analyzed
-//            ElemType element - the element being removed from the tree
-//Returns: Node - the new node of the subtree
-//Does: Recursively removes the value from the passed in tree
-template<typename ElemType>
-typename AVL<ElemType>::Node *AVL<ElemType>::remove_recur(Node *node, ElemType element)
-{
-        if (node == nullptr) 
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
+        path.clear();
+        Node **link = &root;
+        while (*link != nullptr)
         {
-                return node;
+                Node *node = *link;
+                StatsPolicy::node_visit();
+                int cmp = compare_keys(element, node->data);
+                if (cmp == 0)
+                {
+                        break;
+                }
+                path.push_back(link);
+                link = (cmp < 0) ? &node->left : &node->right;
         }
-        if (element < node->data)
+        if (*link == nullptr)
         {
-                node->left = remove_recur(node->left, element);
+                return false;
         } 
-        else if (element > node->data)
+        Node *target = *link;
+        if (target->left != nullptr and target->right != nullptr)
         {
-                node->right = remove_recur(node->right, element);
+                path.push_back(link);
+                link = &target->right;
+                while ((*link)->left != nullptr)
+                {
+                        StatsPolicy::node_visit();
+                        path.push_back(link);
+                        link = &(*link)->left;
+                }
+                target->data = (*link)->data;
+                target->count = (*link)->count;
+                target = *link;
         }
-        else 
+        *link = (target->left != nullptr) ? target->left : target->right;
+        delete target;
+        for (int i = (int)path.size() - 1; i >= 0; i--)
         {
-                if (node->right == nullptr || node->left == nullptr)
+                Node *node = *path[i];
+                int old_height = node->height;
+                Node *top;
+                if (weak)
                 {
-                        Node *temp = node->left ? node->left : node->right;
-                        if (temp == nullptr)
-                        {
-                                temp = node;
-                                node = nullptr;
-                        }
-                        else 
-                        {
-                                *node = *temp;
-                                
-                        }
-                        delete temp;
+                        top = weak_remove_fix(node);
                 }
                 else 
                 {
-                        Node *temp = find_min_value(node->right);
-                        node->data = temp->data;
-                        node->right = remove_recur(node->right, temp->data);
+                        node->height = 1 + max(node_height(node->left), node_height(node->right));
+                        top = balance(node);
                 }
+                if (top != node)
+                {
+                        *path[i] = top;
+                }
+                if (top->height == old_height)
+                {
+                        break;
+                }
+        }
+        return true;
+}
+
+//remove_range function
+//Parameters: const ElemType &lo, const ElemType &hi - bounds of the
+//            range being removed (both inclusive)
+//Returns: int - the number of elements removed, counting duplicates
+//Does: Splits the tree into the elements below, inside and above the
+//      range, deletes the middle tree whole and joins the other two,
+//      so the cost is O(log n) plus one delete per removed node
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int AVL<ElemType, Compare, StatsPolicy>::remove_range(const ElemType &lo, const ElemType &hi)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
+        if (compare_keys(hi, lo) < 0)
+        {
+                return 0;
         }
+        Node *below, *rest, *inside, *above;
+        split(root, lo, false, below, rest);
+        split(rest, hi, true, inside, above);
+        root = join2(below, above);
+        return remove_subtree(inside);
+}
+
+//remove_less_than function
+//Parameters: const ElemType &key - elements ordered before key are removed
+//Returns: int - the number of elements removed, counting duplicates
+//Does: Splits off every element less than key and deletes it, used to
+//      expire old keys in one O(log n) pass plus the deletes
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int AVL<ElemType, Compare, StatsPolicy>::remove_less_than(const ElemType &key)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
+        Node *below;
+        split(root, key, false, below, root);
+        return remove_subtree(below);
+}
+
+//elements_in_range function
+//Parameters: const ElemType &lo, const ElemType &hi - bounds of the
+//            range (both inclusive)
+//            std::vector<ElemType> &out - the elements are appended here
+//Returns: int - the number of elements appended, counting duplicates
+//Does: Appends the elements in the range in order, each as many times
+//      as it was inserted. Only subtrees that can overlap the range are
+//      visited, so the cost is O(log n) plus the elements appended
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int AVL<ElemType, Compare, StatsPolicy>::elements_in_range(const ElemType &lo, const ElemType &hi,
+                                                           std::vector<ElemType> &out)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        size_t before = out.size();
+        if (compare_keys(hi, lo) >= 0)
+        {
+                collect_range(root, lo, hi, out);
+        }
+        return out.size() - before;
+}
+
+//collect_range function (private)
+//Parameters: Node *node - the root of the subtree being walked
+//            const ElemType &lo, const ElemType &hi - inclusive bounds
+//            std::vector<ElemType> &out - the elements are appended here
+//Returns: Nothing
+//Does: In order walk that skips the left subtree of nodes below lo and
+//      the right subtree of nodes above hi
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void AVL<ElemType, Compare, StatsPolicy>::collect_range(Node *node, const ElemType &lo,
+                                                        const ElemType &hi, std::vector<ElemType> &out)
+{
         if (node == nullptr)
         {
-                return node;
+                return;
         }
-        node->height = 1 + max(node_height(node->left), node_height(node->right));
-        node = balance(node);
+        StatsPolicy::node_visit();
+        bool above_lo = compare_keys(node->data, lo) >= 0;
+        bool below_hi = compare_keys(node->data, hi) <= 0;
+        if (above_lo)
+        {
+                collect_range(node->left, lo, hi, out);
+        }
+        if (above_lo and below_hi)
+        {
+                out.insert(out.end(), node->count, node->data);
+        }
+        if (below_hi)
+        {
+                collect_range(node->right, lo, hi, out);
+        }
+}
 
-        return node;
+//split function (private)
+//Parameters: Node *node - the root of the tree being split
+//            const ElemType &key - the value the tree is split at
+//            bool inclusive - whether elements equal to key go left
+//            Node *&left - set to the tree of elements before key
+//            Node *&right - set to the tree of elements after key
+//Returns: Nothing
+//Does: Walks down the search path for key, joining the subtrees hanging
+//      off each side of the path back together on the way up
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void AVL<ElemType, Compare, StatsPolicy>::split(Node *node, const ElemType &key,
+                                bool inclusive, Node *&left, Node *&right)
+{
+        if (node == nullptr)
+        {
+                left = right = nullptr;
+                return;
+        }
+        StatsPolicy::node_visit();
+        int cmp = compare_keys(key, node->data);
+        Node *part;
+        if (cmp > 0 || (inclusive && cmp == 0))
+        {
+                split(node->right, key, inclusive, part, right);
+                left = join(node->left, node, part);
+        }
+        else
+        {
+                split(node->left, key, inclusive, left, part);
+                right = join(part, node, node->right);
+        }
 }
 
-//find_min_value function
-//Parameters: Node *node - the node being analyzed
-//Returns: Node of the minimum value
-//Does: Returns the ndoe with the minimum value stored in a particular subtree
-template<typename ElemType>
-typename AVL<ElemType>::Node *AVL<ElemType>::find_min_value(Node *node)
+//join function (private)
+//Parameters: Node *left - tree of elements before mid
+//            Node *mid - detached node placed between the two trees
+//            Node *right - tree of elements after mid
+//Returns: Node - the root of the joined tree
+//Does: Walks down the side of the taller tree until the heights match,
+//      hangs mid there and rebalances on the way back up, which costs
+//      O(difference in heights)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename AVL<ElemType, Compare, StatsPolicy>::Node *AVL<ElemType, Compare, StatsPolicy>::join(Node *left, Node *mid, Node *right)
 {
-        Node *temp = node;
-        while(temp->left != nullptr)
+        if (node_height(left) > node_height(right) + 1)
+        {
+                left->right = join(left->right, mid, right);
+                left->height = 1 + max(node_height(left->left), node_height(left->right));
+                return balance(left);
+        }
+        if (node_height(right) > node_height(left) + 1)
         {
-                temp = temp->left;
+                right->left = join(left, mid, right->left);
+                right->height = 1 + max(node_height(right->left), node_height(right->right));
+                return balance(right);
         }
-        return temp;
+        mid->left = left;
+        mid->right = right;
+        mid->height = 1 + max(node_height(left), node_height(right));
+        return mid;
+}
+
+//join2 function (private)
+//Parameters: Node *left - tree of elements before right
+//            Node *right - tree of elements after left
+//Returns: Node - the root of the joined tree
+//Does: Uses the minimum of the right tree as the middle node of a join
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename AVL<ElemType, Compare, StatsPolicy>::Node *AVL<ElemType, Compare, StatsPolicy>::join2(Node *left, Node *right)
+{
+        if (left == nullptr)
+        {
+                return right;
+        }
+        if (right == nullptr)
+        {
+                return left;
+        }
+        Node *min;
+        right = remove_min(right, min);
+        return join(left, min, right);
+}
+
+//remove_min function (private)
+//Parameters: Node *node - the root of the tree
+//            Node *&min - set to the detached minimum node
+//Returns: Node - the new root of the tree
+//Does: Unlinks the leftmost node without deleting it and rebalances
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename AVL<ElemType, Compare, StatsPolicy>::Node *AVL<ElemType, Compare, StatsPolicy>::remove_min(Node *node, Node *&min)
+{
+        if (node->left == nullptr)
+        {
+                min = node;
+                return node->right;
+        }
+        node->left = remove_min(node->left, min);
+        node->height = 1 + max(node_height(node->left), node_height(node->right));
+        return balance(node);
+}
+
+//remove_subtree function (private)
+//Parameters: Node *node - the root of a tree detached from the AVL
+//Returns: int - the number of elements stored in it, counting duplicates
+//Does: Deletes every node of the tree
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int AVL<ElemType, Compare, StatsPolicy>::remove_subtree(Node *node)
+{
+        if (node == nullptr)
+        {
+                return 0;
+        }
+        int removed = node->count + remove_subtree(node->left) +
+                      remove_subtree(node->right);
+        delete node;
+        return removed;
 }
 
 //balance function 
@@ -268,8 +680,8 @@ typename AVL<ElemType>::Node *AVL<ElemType>::find_min_value(Node *node)
 //Returns: Node - the new root of the tree
 //Does: Checks if the current subtree is balanced and balances
 //      the tree if necessary
-template<typename ElemType>
-typename AVL<ElemType>::Node *AVL<ElemType>::balance(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename AVL<ElemType, Compare, StatsPolicy>::Node *AVL<ElemType, Compare, StatsPolicy>::balance(Node *node)
 {
         if (node == nullptr) { 
                 return nullptr;
@@ -277,7 +689,7 @@ typename AVL<ElemType>::Node *AVL<ElemType>::balance(Node *node)
 
         int diff = height_diff(node);
         if (diff > 1) { 
-                if (height_diff(node->left) > 0) {
+                if (height_diff(node->left) >= 0) {
                         return right_rotate(node);
                 }
                 else {
@@ -286,7 +698,7 @@ typename AVL<ElemType>::Node *AVL<ElemType>::balance(Node *node)
                 }
         }
         if (diff < -1) { 
-                if (height_diff(node->right) < 0) {
+                if (height_diff(node->right) <= 0) {
                         return left_rotate(node);
                 }
                 else {
@@ -297,13 +709,141 @@ typename AVL<ElemType>::Node *AVL<ElemType>::balance(Node *node)
         return node;
 }
 
+//weak_insert_fix function (private)
+//Parameters: Node *node - a node whose subtree just had an insert
+//Returns: Node - the new root of the subtree
+//Does: In a WAVL tree every rank difference (rank of a node minus the
+//      rank of a child, with null at -1) is 1 or 2. An insert can only
+//      break this by promoting a child to node's rank. If the other
+//      child is a 1-child node is promoted and the problem moves up;
+//      otherwise one single or double rotation fixes it for good
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename AVL<ElemType, Compare, StatsPolicy>::Node *AVL<ElemType, Compare, StatsPolicy>::weak_insert_fix(Node *node)
+{
+        int rank = node->height;
+        if (node_height(node->left) == rank)
+        {
+                if (rank - node_height(node->right) == 1)
+                {
+                        node->height++;
+                        return node;
+                }
+                Node *child = node->left;
+                Node *inner = child->right;
+                if (rank - node_height(inner) == 2)
+                {
+                        node = right_rotate(node);
+                        node->height = rank;
+                        node->right->height = rank - 1;
+                        return node;
+                }
+                node->left = left_rotate(child);
+                node = right_rotate(node);
+                node->height = rank;
+                node->left->height = rank - 1;
+                node->right->height = rank - 1;
+                return node;
+        }
+        if (node_height(node->right) == rank)
+        {
+                if (rank - node_height(node->left) == 1)
+                {
+                        node->height++;
+                        return node;
+                }
+                Node *child = node->right;
+                Node *inner = child->left;
+                if (rank - node_height(inner) == 2)
+                {
+                        node = left_rotate(node);
+                        node->height = rank;
+                        node->left->height = rank - 1;
+                        return node;
+                }
+                node->right = right_rotate(child);
+                node = left_rotate(node);
+                node->height = rank;
+                node->left->height = rank - 1;
+                node->right->height = rank - 1;
+                return node;
+        }
+        return node;
+}
+
+//weak_remove_fix function (private)
+//Parameters: Node *node - a node whose subtree just had a delete
+//Returns: Node - the new root of the subtree
+//Does: A delete can leave node as a leaf of rank 1 or give it a child
+//      with rank difference 3. Demoting node (and its sibling child
+//      when that is a 2,2 node) fixes node but may push the problem up
+//      a level; otherwise one single or double rotation ends it. Nodes
+//      whose ranks are fine are left untouched, so unlike the height
+//      rule nothing is rewritten above the point where the ranks settle
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename AVL<ElemType, Compare, StatsPolicy>::Node *AVL<ElemType, Compare, StatsPolicy>::weak_remove_fix(Node *node)
+{
+        int rank = node->height;
+        if (node->left == nullptr and node->right == nullptr)
+        {
+                node->height = 0;
+                return node;
+        }
+        bool left_short = (rank - node_height(node->left) == 3);
+        if (!left_short and rank - node_height(node->right) != 3)
+        {
+                return node;
+        }
+        Node *sibling = left_short ? node->right : node->left;
+        if (rank - sibling->height == 2)
+        {
+                node->height--;
+                return node;
+        }
+        Node *outer = left_short ? sibling->right : sibling->left;
+        Node *inner = left_short ? sibling->left : sibling->right;
+        int sibling_rank = sibling->height;
+        if (sibling_rank - node_height(outer) == 2 and
+            sibling_rank - node_height(inner) == 2)
+        {
+                node->height--;
+                sibling->height--;
+                return node;
+        }
+        if (sibling_rank - node_height(outer) == 1)
+        {
+                Node *top = left_short ? left_rotate(node) : right_rotate(node);
+                top->height = rank;
+                node->height = rank - 1;
+                if (node->left == nullptr and node->right == nullptr)
+                {
+                        node->height = 0;
+                }
+                return top;
+        }
+        if (left_short)
+        {
+                node->right = right_rotate(sibling);
+                node = left_rotate(node);
+        }
+        else
+        {
+                node->left = left_rotate(sibling);
+                node = right_rotate(node);
+        }
+        node->height = rank;
+        (left_short ? node->left : node->right)->height = rank - 2;
+        sibling->height = rank - 2;
+        return node;
+}
+
 //right_rotate function
 //Parameters: Node *node - a node of the AVL tree
 //Returns: Node - the root of the balanced subtree
 //Does: Performs a right rotation of the subtree starting at node
-template<typename ElemType>
-typename AVL<ElemType>::Node *AVL<ElemType>::right_rotate(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename AVL<ElemType, Compare, StatsPolicy>::Node *AVL<ElemType, Compare, StatsPolicy>::right_rotate(Node *node)
 {
+        StatsPolicy::rotation();
         Node *left_node = node->left;
         Node *right_node = left_node->right;
 
@@ -321,9 +861,10 @@ typename AVL<ElemType>::Node *AVL<ElemType>::right_rotate(Node *node)
 //Parameters: Node *node - a node of the AVL tree
 //Returns: Node - the root ofthe balanced subtree
 //Does: Performs a left rotation of the subtree starting at node
-template<typename ElemType>
-typename AVL<ElemType>::Node *AVL<ElemType>::left_rotate(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename AVL<ElemType, Compare, StatsPolicy>::Node *AVL<ElemType, Compare, StatsPolicy>::left_rotate(Node *node)
 {
+        StatsPolicy::rotation();
         Node *right_node = node->right;
         Node *left_node = right_node->left;
 
@@ -342,8 +883,8 @@ typename AVL<ElemType>::Node *AVL<ElemType>::left_rotate(Node *node)
 //Returns: integer value signifying the height difference.
 //Does: calculates the difference in the height of the left and child 
 //      subtree of np
-template<typename ElemType>
-int AVL<ElemType>::height_diff(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int AVL<ElemType, Compare, StatsPolicy>::height_diff(Node *node)
 {
         int l_height = node_height(node->left);
         int r_height = node_height(node->right);
@@ -360,8 +901,8 @@ int AVL<ElemType>::height_diff(Node *node)
 //            Node *right - the value stored as the right child
 //Returns: Node - the new node created
 //Does: Creates a new node in the leaf position of an AVL tree
-template<typename ElemType>
-typename AVL<ElemType>::Node *AVL<ElemType>::new_node(ElemType element, int height, int count, Node *left, Node *right)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename AVL<ElemType, Compare, StatsPolicy>::Node *AVL<ElemType, Compare, StatsPolicy>::new_node(ElemType element, int height, int count, Node *left, Node *right)
 {
         Node *temp_node = new Node();
     
@@ -378,8 +919,8 @@ typename AVL<ElemType>::Node *AVL<ElemType>::new_node(ElemType element, int heig
 //Parameters: Node *node - the node currently being analyzed
 //Returns: int - the height of the node
 //Does: Takes a node and returns the height 
-template<typename ElemType>
-int AVL<ElemType>::node_height(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int AVL<ElemType, Compare, StatsPolicy>::node_height(Node *node)
 {
         if (node == nullptr)
         {
@@ -392,8 +933,8 @@ int AVL<ElemType>::node_height(Node *node)
 //Parameters: Nothing 
 //Returns: Int - the height of the tree
 //Does: Searches for and returns the height of the AVL Tree
-template<typename ElemType>
-int AVL<ElemType>::tree_height()
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int AVL<ElemType, Compare, StatsPolicy>::tree_height()
 {
         return tree_height_recur(root);
 }
@@ -402,8 +943,8 @@ int AVL<ElemType>::tree_height()
 //Parameters: Node *node - the root of the tree currently being manipulated
 //Returns: Int - the height of the current tree
 //Does: Checks and returns the height of the current tree
-template<typename ElemType>
-int AVL<ElemType>::tree_height_recur(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int AVL<ElemType, Compare, StatsPolicy>::tree_height_recur(Node *node)
 {
         if (root == nullptr)
         {
@@ -431,8 +972,8 @@ int AVL<ElemType>::tree_height_recur(Node *node)
 //Returns: bool - whether or not a node is considered to be a leaf 
 //                (has no children)
 //Does: Returns whether or not a certain node is a leaf or not
-template<typename ElemType>
-bool AVL<ElemType>::is_a_leaf(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+bool AVL<ElemType, Compare, StatsPolicy>::is_a_leaf(Node *node)
 {
         if (node == nullptr)
         {
@@ -449,8 +990,8 @@ bool AVL<ElemType>::is_a_leaf(Node *node)
 //Parameters: Nothing 
 //Returns: Int - total node count
 //Does: Returns the total amount of nodes in a tree
-template<typename ElemType>
-int AVL<ElemType>::node_count()
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int AVL<ElemType, Compare, StatsPolicy>::node_count()
 {
         return node_count_recur(root);
 }
@@ -460,8 +1001,8 @@ int AVL<ElemType>::node_count()
 //Returns: Int - the number of nodes in the current tree
 //Does: Checks for the number of nodes in the tree starting at the
 //      passed in node 
-template<typename ElemType>
-int AVL<ElemType>::node_count_recur(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int AVL<ElemType, Compare, StatsPolicy>::node_count_recur(Node *node)
 {
         int total_count = 0;
         if (node == nullptr)
@@ -477,8 +1018,8 @@ int AVL<ElemType>::node_count_recur(Node *node)
 //Parameters: Nothing 
 //Returns: int - total value of all nodes
 //Does: Returns the sum of all the node values (including duplicates)
-template<typename ElemType>
-int AVL<ElemType>::count_total()
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int AVL<ElemType, Compare, StatsPolicy>::count_total()
 {
         return count_total_recur(root);
 }
@@ -488,8 +1029,8 @@ int AVL<ElemType>::count_total()
 //Returns: Int - sum of all values in current tree
 //Does: Returns the sum of all the node values (including duplicates)
 //      in the tree starting at the passed in node
-template<typename ElemType>
-int AVL<ElemType>::count_total_recur(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int AVL<ElemType, Compare, StatsPolicy>::count_total_recur(Node *node)
 {
         if (node == nullptr)
         {
@@ -508,8 +1049,8 @@ int AVL<ElemType>::count_total_recur(Node *node)
 //Returns: Nothing
 //Does: prints all elements within the tree (uncomment the type 
 //      of traversal used)
-template<typename ElemType>
-void AVL<ElemType>::print_tree()
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void AVL<ElemType, Compare, StatsPolicy>::print_tree()
 {
         //Uncomment the type of traversal wanted:
         // in_order_print(root);
@@ -523,8 +1064,8 @@ void AVL<ElemType>::print_tree()
 //Returns: Nothing
 //Does: Prints the contents of the tree using
 //      an in-order traversal
-template<typename ElemType>
-void AVL<ElemType>::in_order_print(Node *root)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void AVL<ElemType, Compare, StatsPolicy>::in_order_print(Node *root)
 {
         if (root == nullptr)
         {
@@ -540,8 +1081,8 @@ void AVL<ElemType>::in_order_print(Node *root)
 //Returns: Nothing
 //Does: Prints the contents of the tree using
 //      a pre-order traversal
-template<typename ElemType>
-void AVL<ElemType>::pre_order_print(Node *root)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void AVL<ElemType, Compare, StatsPolicy>::pre_order_print(Node *root)
 {
         stack<Node *> list;
         if (root != nullptr){
@@ -565,8 +1106,8 @@ void AVL<ElemType>::pre_order_print(Node *root)
 //Returns: Nothing
 //Does: Prints the contents of the tree using 
 //      a level-order traversal
-template<typename ElemType>
-void AVL<ElemType>::level_order_print(Node *root)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void AVL<ElemType, Compare, StatsPolicy>::level_order_print(Node *root)
 {
         queue<Node *> list;
         if (root != nullptr) 
@@ -586,4 +1127,42 @@ void AVL<ElemType>::level_order_print(Node *root)
                 }
                 list.pop();
         }
-}
\ No newline at end of file
+}
+
+//stats function
+//Parameters: Nothing
+//Returns: StatsSnapshot - copy of the counters kept by the StatsPolicy
+//Does: Reports comparisons, rotations, node visits and per operation
+//      latencies (all zero unless the tree is built with OpStats)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+StatsSnapshot AVL<ElemType, Compare, StatsPolicy>::stats()
+{
+        return StatsPolicy::snapshot();
+}
+
+//memory_usage function
+//Parameters: Nothing
+//Returns: size_t - bytes used by the nodes
+//Does: Multiplies the node count by the node size. Divide by
+//      node_count() for the overhead per key
+template<typename ElemType, typename Compare, typename StatsPolicy>
+size_t AVL<ElemType, Compare, StatsPolicy>::memory_usage()
+{
+        return node_count() * sizeof(Node);
+}
+
+//compare_keys function
+//Parameters: const A &a, const B &b - keys being compared
+//Returns: int - negative if a orders before b, zero if they are equal,
+//         positive if a orders after b
+//Does: Compares two keys with the tree's comparator, counting the
+//      comparison
+template<typename ElemType, typename Compare, typename StatsPolicy>
+template<typename A, typename B>
+int AVL<ElemType, Compare, StatsPolicy>::compare_keys(const A &a, const B &b)
+{
+        StatsPolicy::comparison();
+        return compare(a, b);
+}
+
+#endif
\ No newline at end of file
@@ -12,12 +12,31 @@
 #ifndef AVL_H_
 #define AVL_H_
 
-template<typename ElemType>
-class AVL
+#include "../Comparators/ThreeWayCompare.h"
+#include "../Instrumentation/OpStats.h"
+
+#include <cstddef>
+#include <vector>
+
+//how an AVL keeps itself balanced. HEIGHT_BALANCED is the classic AVL
+//rule; RANK_BALANCED is the weak AVL (WAVL) rule, which treats height as
+//a rank that may exceed the real height after deletes, so a delete does
+//at most two rotations and stops as soon as the ranks settle
+enum AVLBalance {HEIGHT_BALANCED, RANK_BALANCED};
+
+template<typename ElemType, typename Compare = ThreeWayCompare,
+         typename StatsPolicy = NoStats>
+class AVL : private StatsPolicy
 {
         public:
                 //Constructor
                 AVL();
+                //Comparator Constructor
+                AVL(const Compare &comp);
+                //Balance Mode Constructor
+                AVL(AVLBalance mode);
+                //Comparator and Balance Mode Constructor
+                AVL(const Compare &comp, AVLBalance mode);
                 //Destructor
                 ~AVL();
                 //Copy Constructor
@@ -25,11 +44,33 @@ class AVL
                 //Assignment operator
                 AVL &operator=(const AVL &rhs);
                 //checks if an element is stored in the AVL
-                bool contains(ElemType element);
-                //isnerts an element
-                void insert(ElemType element);
-                //removes an element
-                void remove(ElemType element);
+                bool contains(const ElemType &element);
+                //checks if an element equal to the key is stored, without
+                //converting the key to an ElemType (transparent Compare only)
+                template<typename Key, typename C = Compare,
+                         typename = typename C::is_transparent>
+                bool contains(const Key &key);
+                //checks n keys at once, out[i] is set to whether keys[i]
+                //is stored
+                void contains_batch(const ElemType *keys, int n, bool *out);
+                //returns how many of the n keys are stored
+                int contains_batch(const ElemType *keys, int n);
+                //isnerts an element, returns false if it was already stored
+                //and only its count went up
+                bool insert(ElemType element);
+                //inserts an element unless it is already stored, returns
+                //whether it was added
+                bool insert_unique(ElemType element);
+                //removes an element, returns false if it was not stored
+                bool remove(ElemType element);
+                //removes every element in [lo, hi], returns how many
+                int remove_range(const ElemType &lo, const ElemType &hi);
+                //removes every element less than key, returns how many
+                int remove_less_than(const ElemType &key);
+                //appends every element in [lo, hi] to out in order,
+                //returns how many were appended
+                int elements_in_range(const ElemType &lo, const ElemType &hi,
+                                      std::vector<ElemType> &out);
                 //Checks the height of a tree
                 int tree_height();
                 //Counts number of nodes
@@ -38,6 +79,10 @@ class AVL
                 int count_total();
                 //prints values stored in the AVL
                 void print_tree();
+                //returns a snapshot of the operation counters
+                StatsSnapshot stats();
+                //returns the bytes held by the tree's nodes
+                size_t memory_usage();
 
         private:
 
@@ -52,20 +97,46 @@ class AVL
                 };
                 //root of the AVL
                 Node *root;
+                //orders the elements
+                Compare compare;
+                //true in RANK_BALANCED (WAVL) mode, where height is a rank
+                bool weak;
+                //links followed by the last insert or remove, kept between
+                //calls so neither allocates once it has grown to the height
+                std::vector<Node **> path;
                 //creates a deep copy of a tree
                 Node *copy_tree(Node *node);
                 //removes all nodes from a tree
                 void delete_tree(Node *node);
-                //checks if an element is stored in a AVL
-                bool contains_recur(Node *node, ElemType element);
-                //insert to a specific tree
-                Node *insert_recur(Node *node, ElemType element);
-                //removes element from the current subtree
-                Node *remove_recur(Node *node, ElemType element);
-                //finds the minimum value stored in a tree
-                Node *find_min_value(Node *node);
+                //shared body of insert and insert_unique
+                bool insert_node(ElemType element, bool count_duplicate);
+                //finds the node storing an element equal to the key
+                template<typename Key>
+                Node *find_node(const Key &key);
+                //number of lookups contains_batch keeps in flight
+                static const int BATCH_LANES = 16;
+                //interleaved descents behind both contains_batch versions
+                int lookup_batch(const ElemType *keys, int n, bool *out);
+                //splits a tree into the elements before and after a key
+                void split(Node *node, const ElemType &key, bool inclusive,
+                           Node *&left, Node *&right);
+                //joins two trees around a middle node
+                Node *join(Node *left, Node *mid, Node *right);
+                //joins two trees with no middle node
+                Node *join2(Node *left, Node *right);
+                //detaches the minimum node of a tree
+                Node *remove_min(Node *node, Node *&min);
+                //in order walk of the part of a subtree inside [lo, hi]
+                void collect_range(Node *node, const ElemType &lo,
+                                   const ElemType &hi, std::vector<ElemType> &out);
+                //deletes a detached subtree, returns the elements it held
+                int remove_subtree(Node *node);
                 //Balances a tree to satisfy invariants
                 Node *balance(Node *node);
+                //restores the WAVL rank rule after an insert below node
+                Node *weak_insert_fix(Node *node);
+                //restores the WAVL rank rule after a delete below node
+                Node *weak_remove_fix(Node *node);
                 //Creates and allocates memory for a new node
                 Node *new_node(ElemType element, int height, int count, Node *right, Node *left);
                 //Rotates the current node rightward to maintain AVL invariants
@@ -91,6 +162,9 @@ class AVL
                 void pre_order_print(Node *root);
                 //level order traversal print
                 void level_order_print(Node *root);
+                //three way comparison of two keys, counting the comparison
+                template<typename A, typename B>
+                int compare_keys(const A &a, const B &b);
 };
 
 #endif
\ No newline at end of file
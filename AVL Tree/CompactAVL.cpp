@@ -0,0 +1,627 @@
+/*
+ *
+ * Compact AVL Tree Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * CompactAVL.cpp
+ * Full function declaration
+ *
+ */
+
+#include "CompactAVL.h"
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+
+//default constructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Initializes an empty instance of the Class
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+CompactAVL<ElemType, Compare, Counted, StatsPolicy>::CompactAVL()
+{
+        init_pool();
+}
+
+//comparator constructor
+//Parameters: const Compare &comp - the comparator used to order elements
+//Returns: Nothing
+//Does: Initializes an empty instance of the Class that orders its
+//      elements with the passed in comparator
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+CompactAVL<ElemType, Compare, Counted, StatsPolicy>::CompactAVL(const Compare &comp)
+{
+        init_pool();
+        compare = comp;
+}
+
+//destructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Frees the node pool in one go
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+CompactAVL<ElemType, Compare, Counted, StatsPolicy>::~CompactAVL()
+{
+        delete [] pool;
+}
+
+//copy constructor
+//Parameters: const CompactAVL &rhs, the tree being copied
+//Returns: Nothing
+//Does: Copies the pool of rhs slot for slot, the indices stay valid
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+CompactAVL<ElemType, Compare, Counted, StatsPolicy>::CompactAVL(const CompactAVL &rhs)
+{
+        copy_pool(rhs);
+}
+
+//assignment operator
+//Parameters: const CompactAVL &rhs, the tree being copied
+//Returns: CompactAVL, the object that copied all data from rhs
+//Does: Frees the current pool and copies the pool of rhs
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+CompactAVL<ElemType, Compare, Counted, StatsPolicy> &CompactAVL<ElemType, Compare, Counted, StatsPolicy>::operator=(const CompactAVL &rhs)
+{
+        if (this != &rhs)
+        {
+                delete [] pool;
+                copy_pool(rhs);
+        }
+        return *this;
+}
+
+//contains Function
+//Paramters: const ElemType &element - the value being checked for
+//Returns: bool - whether or not the value is stored in the tree
+//Does: Checks if a passed in value is stored within the tree
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+bool CompactAVL<ElemType, Compare, Counted, StatsPolicy>::contains(const ElemType &element)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        return find_node(element) != NIL;
+}
+
+//contains Function (heterogeneous)
+//Parameters: const Key &key - a value comparable with ElemType
+//Returns: bool - whether or not an equal value is stored in the tree
+//Does: Looks up a key of another type without constructing an
+//      ElemType. Only enabled when Compare declares is_transparent
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+template<typename Key, typename Cmp, typename>
+bool CompactAVL<ElemType, Compare, Counted, StatsPolicy>::contains(const Key &key)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        return find_node(key) != NIL;
+}
+
+//insert Function
+//Parameters: ElemType element - the value that is being stored in the tree
+//Returns: Nothing
+//Does: Inserts an element into the tree. A duplicate bumps the count of
+//      its node, or is ignored when the tree is not Counted
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+void CompactAVL<ElemType, Compare, Counted, StatsPolicy>::insert(ElemType element)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
+        bool grew;
+        root = insert_recur(root, element, grew);
+}
+
+//remove function
+//Parameters: ElemType element - value being removed from the tree
+//Returns: Nothing
+//Does: Removes one copy of the element, and its node once no copies
+//      are left
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+void CompactAVL<ElemType, Compare, Counted, StatsPolicy>::remove(ElemType element)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
+        bool shrank;
+        root = remove_recur(root, element, shrank);
+}
+
+//tree_height Function
+//Parameters: Nothing
+//Returns: Int - the height of the tree, -1 if it is empty
+//Does: Searches for and returns the height of the tree
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+int CompactAVL<ElemType, Compare, Counted, StatsPolicy>::tree_height()
+{
+        return tree_height_recur(root);
+}
+
+//node_count Function
+//Parameters: Nothing
+//Returns: Int - total node count
+//Does: Returns the number of nodes in use
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+int CompactAVL<ElemType, Compare, Counted, StatsPolicy>::node_count()
+{
+        return num_nodes;
+}
+
+//print_tree function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: prints all elements within the tree in order
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+void CompactAVL<ElemType, Compare, Counted, StatsPolicy>::print_tree()
+{
+        in_order_print(root);
+        cout << endl;
+}
+
+//stats function
+//Parameters: Nothing
+//Returns: StatsSnapshot - copy of the counters kept by the StatsPolicy
+//Does: Reports comparisons, rotations, pool reallocations, node visits
+//      and per operation latencies (all zero unless the tree is built
+//      with OpStats)
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+StatsSnapshot CompactAVL<ElemType, Compare, Counted, StatsPolicy>::stats()
+{
+        return StatsPolicy::snapshot();
+}
+
+//memory_usage function
+//Parameters: Nothing
+//Returns: size_t - bytes allocated for the node pool
+//Does: Reports the whole pool, including free and spare slots. Divide
+//      by node_count() for the overhead per key
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+size_t CompactAVL<ElemType, Compare, Counted, StatsPolicy>::memory_usage()
+{
+        return pool_capacity * sizeof(Node);
+}
+
+//init_pool function (private)
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Starts with no pool, the first insert allocates one
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+void CompactAVL<ElemType, Compare, Counted, StatsPolicy>::init_pool()
+{
+        pool = nullptr;
+        pool_capacity = pool_used = 0;
+        free_list = root = NIL;
+        num_nodes = 0;
+}
+
+//copy_pool function (private)
+//Parameters: const CompactAVL &rhs, the tree being copied
+//Returns: Nothing
+//Does: Allocates a pool the size of rhs's and copies every slot
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+void CompactAVL<ElemType, Compare, Counted, StatsPolicy>::copy_pool(const CompactAVL &rhs)
+{
+        compare = rhs.compare;
+        pool_capacity = rhs.pool_capacity;
+        pool_used = rhs.pool_used;
+        free_list = rhs.free_list;
+        root = rhs.root;
+        num_nodes = rhs.num_nodes;
+        pool = (pool_capacity > 0) ? new Node[pool_capacity] : nullptr;
+        for (uint32_t i = 0; i < pool_used; i++)
+        {
+                pool[i] = rhs.pool[i];
+        }
+}
+
+//new_node function (private)
+//Parameters: const ElemType &element - value stored in the new node
+//Returns: uint32_t - index of the new node
+//Does: Reuses a freed slot if there is one, otherwise takes the next
+//      slot of the pool, doubling it when full. Indices stay valid when
+//      the pool moves, but Node references do not
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+uint32_t CompactAVL<ElemType, Compare, Counted, StatsPolicy>::new_node(const ElemType &element)
+{
+        uint32_t node = free_list;
+        if (node != NIL)
+        {
+                free_list = pool[node].left;
+        }
+        else
+        {
+                if (pool_used == pool_capacity)
+                {
+                        if (pool_capacity > MAX_NODES)
+                        {
+                                throw runtime_error("CompactAVL node pool "
+                                                        "is full");
+                        }
+                        StatsPolicy::reallocation();
+                        uint32_t new_capacity = (pool_capacity == 0) ? 16 : 2 * pool_capacity;
+                        if (new_capacity > MAX_NODES + 1)
+                        {
+                                new_capacity = MAX_NODES + 1;
+                        }
+                        Node *new_pool = new Node[new_capacity];
+                        for (uint32_t i = 0; i < pool_used; i++)
+                        {
+                                new_pool[i] = pool[i];
+                        }
+                        delete [] pool;
+                        pool = new_pool;
+                        pool_capacity = new_capacity;
+                        if (pool_used == 0)
+                        {
+                                pool_used = 1;
+                        }
+                }
+                node = pool_used;
+                pool_used++;
+        }
+        pool[node].data = element;
+        pool[node].set_copies(1);
+        pool[node].left = NIL;
+        pool[node].right = NIL;
+        set_balance(node, 0);
+        num_nodes++;
+        return node;
+}
+
+//free_node function (private)
+//Parameters: uint32_t node - index of a node already unlinked
+//Returns: Nothing
+//Does: Pushes the slot onto the free list
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+void CompactAVL<ElemType, Compare, Counted, StatsPolicy>::free_node(uint32_t node)
+{
+        pool[node].left = free_list;
+        free_list = node;
+        num_nodes--;
+}
+
+//find_node Function (private)
+//Parameters: const Key &key - the value being looked for
+//Returns: uint32_t - the node storing an equal value, NIL if none
+//Does: Walks down from the root making a single three way comparison
+//      at each node
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+template<typename Key>
+uint32_t CompactAVL<ElemType, Compare, Counted, StatsPolicy>::find_node(const Key &key)
+{
+        uint32_t node = root;
+        while (node != NIL)
+        {
+                StatsPolicy::node_visit();
+                int cmp = compare_keys(key, pool[node].data);
+                if (cmp == 0)
+                {
+                        return node;
+                }
+                node = (cmp < 0) ? pool[node].left : pool[node].right;
+        }
+        return NIL;
+}
+
+//insert_recur Function (private)
+//Parameters: uint32_t node - the root of the current tree
+//            const ElemType &element - the value being inserted
+//            bool &grew - set to whether the subtree got taller
+//Returns: uint32_t - the new root of the subtree
+//Does: Inserts the value recursively and updates balance factors on the
+//      way back up, stopping as soon as a subtree keeps its height
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+uint32_t CompactAVL<ElemType, Compare, Counted, StatsPolicy>::insert_recur(uint32_t node, const ElemType &element, bool &grew)
+{
+        if (node == NIL)
+        {
+                grew = true;
+                return new_node(element);
+        }
+        StatsPolicy::node_visit();
+        int cmp = compare_keys(element, pool[node].data);
+        if (cmp == 0)
+        {
+                pool[node].set_copies(pool[node].copies() + 1);
+                grew = false;
+                return node;
+        }
+        bool shorter;
+        if (cmp < 0)
+        {
+                uint32_t child = insert_recur(pool[node].left, element, grew);
+                pool[node].left = child;
+                if (!grew)
+                {
+                        return node;
+                }
+                int balance = balance_of(node) - 1;
+                if (balance == -2)
+                {
+                        grew = false;
+                        return fix_left_heavy(node, shorter);
+                }
+                set_balance(node, balance);
+                grew = (balance != 0);
+                return node;
+        }
+        uint32_t child = insert_recur(pool[node].right, element, grew);
+        pool[node].right = child;
+        if (!grew)
+        {
+                return node;
+        }
+        int balance = balance_of(node) + 1;
+        if (balance == 2)
+        {
+                grew = false;
+                return fix_right_heavy(node, shorter);
+        }
+        set_balance(node, balance);
+        grew = (balance != 0);
+        return node;
+}
+
+//remove_recur function (Private)
+//Parameters: uint32_t node - the root of the current tree
+//            const ElemType &element - the element being removed
+//            bool &shrank - set to whether the subtree got shorter
+//Returns: uint32_t - the new root of the subtree
+//Does: Removes one copy of the value recursively. A node with two
+//      children is replaced by relinking the minimum of its right
+//      subtree into its place, so no data is copied
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+uint32_t CompactAVL<ElemType, Compare, Counted, StatsPolicy>::remove_recur(uint32_t node, const ElemType &element, bool &shrank)
+{
+        if (node == NIL)
+        {
+                shrank = false;
+                return NIL;
+        }
+        StatsPolicy::node_visit();
+        int cmp = compare_keys(element, pool[node].data);
+        if (cmp < 0)
+        {
+                uint32_t child = remove_recur(pool[node].left, element, shrank);
+                pool[node].left = child;
+                return shrank ? left_shrank(node, shrank) : node;
+        }
+        if (cmp > 0)
+        {
+                uint32_t child = remove_recur(pool[node].right, element, shrank);
+                pool[node].right = child;
+                return shrank ? right_shrank(node, shrank) : node;
+        }
+        if (pool[node].copies() > 1)
+        {
+                pool[node].set_copies(pool[node].copies() - 1);
+                shrank = false;
+                return node;
+        }
+        uint32_t left = pool[node].left;
+        uint32_t right = pool[node].right;
+        if (left == NIL or right == NIL)
+        {
+                free_node(node);
+                shrank = true;
+                return (left == NIL) ? right : left;
+        }
+        uint32_t min;
+        right = remove_min(right, min, shrank);
+        pool[min].left = left;
+        pool[min].right = right;
+        set_balance(min, balance_of(node));
+        free_node(node);
+        return shrank ? right_shrank(min, shrank) : min;
+}
+
+//remove_min function (private)
+//Parameters: uint32_t node - the root of a non empty subtree
+//            uint32_t &min - set to the detached minimum node
+//            bool &shrank - set to whether the subtree got shorter
+//Returns: uint32_t - the new root of the subtree
+//Does: Unlinks the leftmost node without freeing it
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+uint32_t CompactAVL<ElemType, Compare, Counted, StatsPolicy>::remove_min(uint32_t node, uint32_t &min, bool &shrank)
+{
+        if (pool[node].left == NIL)
+        {
+                min = node;
+                shrank = true;
+                return pool[node].right;
+        }
+        uint32_t child = remove_min(pool[node].left, min, shrank);
+        pool[node].left = child;
+        return shrank ? left_shrank(node, shrank) : node;
+}
+
+//left_shrank function (private)
+//Parameters: uint32_t node - a node whose left subtree got shorter
+//            bool &shrank - set to whether the node's subtree got shorter
+//Returns: uint32_t - the new root of the subtree
+//Does: Shifts the balance right, rotating if it reaches +2
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+uint32_t CompactAVL<ElemType, Compare, Counted, StatsPolicy>::left_shrank(uint32_t node, bool &shrank)
+{
+        int balance = balance_of(node) + 1;
+        if (balance == 2)
+        {
+                return fix_right_heavy(node, shrank);
+        }
+        set_balance(node, balance);
+        shrank = (balance == 0);
+        return node;
+}
+
+//right_shrank function (private)
+//Parameters: uint32_t node - a node whose right subtree got shorter
+//            bool &shrank - set to whether the node's subtree got shorter
+//Returns: uint32_t - the new root of the subtree
+//Does: Shifts the balance left, rotating if it reaches -2
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+uint32_t CompactAVL<ElemType, Compare, Counted, StatsPolicy>::right_shrank(uint32_t node, bool &shrank)
+{
+        int balance = balance_of(node) - 1;
+        if (balance == -2)
+        {
+                return fix_left_heavy(node, shrank);
+        }
+        set_balance(node, balance);
+        shrank = (balance == 0);
+        return node;
+}
+
+//fix_left_heavy function (private)
+//Parameters: uint32_t node - a node whose left subtree is two levels
+//                            taller than its right
+//            bool &shorter - set to whether the rotation lowered the
+//                            subtree
+//Returns: uint32_t - the new root of the subtree
+//Does: Performs a right rotation, or a left-right double rotation when
+//      the left child leans right. The new balance factors follow from
+//      the old ones, so the -2 never has to be stored in 2 bits
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+uint32_t CompactAVL<ElemType, Compare, Counted, StatsPolicy>::fix_left_heavy(uint32_t node, bool &shorter)
+{
+        uint32_t child = pool[node].left;
+        int child_balance = balance_of(child);
+        if (child_balance <= 0)
+        {
+                StatsPolicy::rotation();
+                pool[node].left = pool[child].right;
+                pool[child].right = node;
+                if (child_balance == 0)
+                {
+                        set_balance(node, -1);
+                        set_balance(child, 1);
+                }
+                else
+                {
+                        set_balance(node, 0);
+                        set_balance(child, 0);
+                }
+                shorter = (child_balance != 0);
+                return child;
+        }
+        StatsPolicy::rotation();
+        StatsPolicy::rotation();
+        uint32_t grandchild = pool[child].right;
+        int grandchild_balance = balance_of(grandchild);
+        pool[child].right = pool[grandchild].left;
+        pool[node].left = pool[grandchild].right;
+        pool[grandchild].left = child;
+        pool[grandchild].right = node;
+        set_balance(child, (grandchild_balance == 1) ? -1 : 0);
+        set_balance(node, (grandchild_balance == -1) ? 1 : 0);
+        set_balance(grandchild, 0);
+        shorter = true;
+        return grandchild;
+}
+
+//fix_right_heavy function (private)
+//Parameters: uint32_t node - a node whose right subtree is two levels
+//                            taller than its left
+//            bool &shorter - set to whether the rotation lowered the
+//                            subtree
+//Returns: uint32_t - the new root of the subtree
+//Does: Mirror image of fix_left_heavy
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+uint32_t CompactAVL<ElemType, Compare, Counted, StatsPolicy>::fix_right_heavy(uint32_t node, bool &shorter)
+{
+        uint32_t child = pool[node].right;
+        int child_balance = balance_of(child);
+        if (child_balance >= 0)
+        {
+                StatsPolicy::rotation();
+                pool[node].right = pool[child].left;
+                pool[child].left = node;
+                if (child_balance == 0)
+                {
+                        set_balance(node, 1);
+                        set_balance(child, -1);
+                }
+                else
+                {
+                        set_balance(node, 0);
+                        set_balance(child, 0);
+                }
+                shorter = (child_balance != 0);
+                return child;
+        }
+        StatsPolicy::rotation();
+        StatsPolicy::rotation();
+        uint32_t grandchild = pool[child].left;
+        int grandchild_balance = balance_of(grandchild);
+        pool[child].left = pool[grandchild].right;
+        pool[node].right = pool[grandchild].left;
+        pool[grandchild].right = child;
+        pool[grandchild].left = node;
+        set_balance(child, (grandchild_balance == -1) ? 1 : 0);
+        set_balance(node, (grandchild_balance == 1) ? -1 : 0);
+        set_balance(grandchild, 0);
+        shorter = true;
+        return grandchild;
+}
+
+//balance_of function (private)
+//Parameters: uint32_t node - index of a node
+//Returns: int - height of the right subtree minus height of the left
+//Does: Unpacks the 2 bit balance field
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+int CompactAVL<ElemType, Compare, Counted, StatsPolicy>::balance_of(uint32_t node)
+{
+        return (int)pool[node].balance - 1;
+}
+
+//set_balance function (private)
+//Parameters: uint32_t node - index of a node
+//            int balance - -1, 0 or +1
+//Returns: Nothing
+//Does: Packs the balance factor into the 2 bit field
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+void CompactAVL<ElemType, Compare, Counted, StatsPolicy>::set_balance(uint32_t node, int balance)
+{
+        pool[node].balance = balance + 1;
+}
+
+//tree_height_recur Function (private)
+//Parameters: uint32_t node - the root of the tree currently being checked
+//Returns: Int - the height of the current tree, -1 if it is empty
+//Does: Follows the taller side at each node, which the balance factors
+//      give directly, so no recursion is needed
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+int CompactAVL<ElemType, Compare, Counted, StatsPolicy>::tree_height_recur(uint32_t node)
+{
+        int height = -1;
+        while (node != NIL)
+        {
+                height++;
+                node = (balance_of(node) < 0) ? pool[node].left : pool[node].right;
+        }
+        return height;
+}
+
+//in_order_print function (private)
+//Parameters: uint32_t node, the root of the tree
+//Returns: Nothing
+//Does: Prints the contents of the tree using an in-order traversal
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+void CompactAVL<ElemType, Compare, Counted, StatsPolicy>::in_order_print(uint32_t node)
+{
+        if (node == NIL)
+        {
+                return;
+        }
+        in_order_print(pool[node].left);
+        cout << pool[node].data << " ";
+        in_order_print(pool[node].right);
+}
+
+//compare_keys function (private)
+//Parameters: const A &a, const B &b - keys being compared
+//Returns: int - negative if a orders before b, zero if they are equal,
+//         positive if a orders after b
+//Does: Compares two keys with the tree's comparator, counting the
+//      comparison
+template<typename ElemType, typename Compare, bool Counted, typename StatsPolicy>
+template<typename A, typename B>
+int CompactAVL<ElemType, Compare, Counted, StatsPolicy>::compare_keys(const A &a, const B &b)
+{
+        StatsPolicy::comparison();
+        return compare(a, b);
+}
\ No newline at end of file
@@ -0,0 +1,157 @@
+/*
+ *
+ * Compact AVL Tree Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * CompactAVL.h
+ * Class Header and Declaration
+ *
+ * AVL tree laid out for memory per key rather than convenience. Nodes
+ * live in one contiguous pool and link to each other through 32-bit
+ * indices (0 stands for null) instead of 64-bit pointers, the balance
+ * factor (-1, 0 or +1) takes 2 bits beside the right child index instead
+ * of an int height, and the duplicate count is only stored when Counted
+ * is true. With int keys a node is 16 bytes (12 without the count),
+ * against 32 for an AVL node, and freed nodes are reused through a free
+ * list threaded through the pool.
+ *
+ */
+
+#ifndef COMPACTAVL_H_
+#define COMPACTAVL_H_
+
+#include "../Comparators/ThreeWayCompare.h"
+#include "../Instrumentation/OpStats.h"
+
+#include <cstddef>
+#include <cstdint>
+
+//duplicate count stored in each node of a Counted tree
+template<bool Counted>
+struct CompactCount
+{
+        int count;
+        int copies() const { return count; }
+        void set_copies(int copies) { count = copies; }
+};
+
+//set semantics, no count is stored and every key is held once
+template<>
+struct CompactCount<false>
+{
+        int copies() const { return 1; }
+        void set_copies(int) {}
+};
+
+template<typename ElemType, typename Compare = ThreeWayCompare,
+         bool Counted = true, typename StatsPolicy = NoStats>
+class CompactAVL : private StatsPolicy
+{
+        public:
+                //Constructor
+                CompactAVL();
+                //Comparator Constructor
+                CompactAVL(const Compare &comp);
+                //Destructor
+                ~CompactAVL();
+                //Copy Constructor
+                CompactAVL(const CompactAVL &rhs);
+                //Assignment operator
+                CompactAVL &operator=(const CompactAVL &rhs);
+                //checks if an element is stored in the tree
+                bool contains(const ElemType &element);
+                //checks if an element equal to the key is stored, without
+                //converting the key to an ElemType (transparent Compare only)
+                template<typename Key, typename C = Compare,
+                         typename = typename C::is_transparent>
+                bool contains(const Key &key);
+                //inserts an element
+                void insert(ElemType element);
+                //removes one copy of an element
+                void remove(ElemType element);
+                //Checks the height of a tree
+                int tree_height();
+                //Counts number of nodes
+                int node_count();
+                //prints values stored in the tree
+                void print_tree();
+                //returns a snapshot of the operation counters
+                StatsSnapshot stats();
+                //returns the bytes held by the node pool
+                size_t memory_usage();
+
+        private:
+
+                //struct to store node information
+                struct Node : CompactCount<Counted>
+                {
+                        ElemType data;
+                        uint32_t left;
+                        uint32_t right : 30;
+                        //balance factor + 1, so 0 is left heavy and 2 is
+                        //right heavy
+                        uint32_t balance : 2;
+                };
+
+                //index standing for a missing child
+                static const uint32_t NIL = 0;
+                //largest index the 30 bit right field can hold
+                static const uint32_t MAX_NODES = (1u << 30) - 1;
+
+                //the node pool, pool[0] is never used so index 0 is NIL
+                Node *pool;
+                //number of slots in pool
+                uint32_t pool_capacity;
+                //slots handed out so far, including pool[0]
+                uint32_t pool_used;
+                //first freed slot, freed slots are chained through left
+                uint32_t free_list;
+                //index of the root
+                uint32_t root;
+                //number of nodes in the tree
+                int num_nodes;
+                //orders the elements
+                Compare compare;
+
+                //sets up an empty pool
+                void init_pool();
+                //copies another tree's pool
+                void copy_pool(const CompactAVL &rhs);
+                //takes a slot from the free list or the end of the pool
+                uint32_t new_node(const ElemType &element);
+                //returns a slot to the free list
+                void free_node(uint32_t node);
+                //finds the node storing an element equal to the key
+                template<typename Key>
+                uint32_t find_node(const Key &key);
+                //insert to a specific tree
+                uint32_t insert_recur(uint32_t node, const ElemType &element,
+                                      bool &grew);
+                //removes element from the current subtree
+                uint32_t remove_recur(uint32_t node, const ElemType &element,
+                                      bool &shrank);
+                //detaches the minimum node of a subtree
+                uint32_t remove_min(uint32_t node, uint32_t &min, bool &shrank);
+                //updates a node whose left subtree shrank
+                uint32_t left_shrank(uint32_t node, bool &shrank);
+                //updates a node whose right subtree shrank
+                uint32_t right_shrank(uint32_t node, bool &shrank);
+                //rotates a node whose left subtree is two levels taller
+                uint32_t fix_left_heavy(uint32_t node, bool &shorter);
+                //rotates a node whose right subtree is two levels taller
+                uint32_t fix_right_heavy(uint32_t node, bool &shorter);
+                //returns the balance factor of a node
+                int balance_of(uint32_t node);
+                //stores the balance factor of a node
+                void set_balance(uint32_t node, int balance);
+                //finds the height of a tree starting at the passed in node
+                int tree_height_recur(uint32_t node);
+                //in order traversal print
+                void in_order_print(uint32_t node);
+                //three way comparison of two keys, counting the comparison
+                template<typename A, typename B>
+                int compare_keys(const A &a, const B &b);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,392 @@
+/*
+ *
+ * Sharded Set Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * ShardedSet.cpp
+ * Full function implementation
+ *
+ */
+
+#include "ShardedSet.h"
+#include "AVL.cpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+using namespace std;
+
+//default constructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Initializes an empty set that assigns keys to shards by hash
+template<typename ElemType, int Shards, typename Compare, typename Hash>
+ShardedSet<ElemType, Shards, Compare, Hash>::ShardedSet()
+{
+        partition = HASH_SHARDS;
+}
+
+//split point constructor
+//Parameters: const ElemType *split_points - Shards - 1 strictly
+//            ascending keys, shard i holds the keys from
+//            split_points[i-1] up to but not including split_points[i]
+//Returns: Nothing
+//Does: Initializes an empty set that assigns keys to shards by range
+template<typename ElemType, int Shards, typename Compare, typename Hash>
+ShardedSet<ElemType, Shards, Compare, Hash>::ShardedSet(const ElemType *split_points)
+{
+        init_split(split_points);
+}
+
+//comparator and split point constructor
+//Parameters: const Compare &comp - the comparator used to order elements
+//            const ElemType *split_points - Shards - 1 strictly
+//            ascending keys (see the split point constructor)
+//Returns: Nothing
+//Does: Initializes an empty range partitioned set that orders its
+//      elements with the passed in comparator
+template<typename ElemType, int Shards, typename Compare, typename Hash>
+ShardedSet<ElemType, Shards, Compare, Hash>::ShardedSet(const Compare &comp, const ElemType *split_points)
+{
+        compare = comp;
+        for (int s = 0; s < Shards; s++)
+        {
+                shards[s].tree = AVL<ElemType, Compare>(comp);
+        }
+        init_split(split_points);
+}
+
+//contains function
+//Parameters: const ElemType &element - the value being checked for
+//Returns: bool - whether or not the value is stored in the set
+//Does: Looks the value up in its shard while holding that shard's lock
+template<typename ElemType, int Shards, typename Compare, typename Hash>
+bool ShardedSet<ElemType, Shards, Compare, Hash>::contains(const ElemType &element)
+{
+        Shard &shard = shards[shard_of(element)];
+        lock_guard<mutex> guard(shard.lock);
+        return shard.tree.contains(element);
+}
+
+//insert function
+//Parameters: const ElemType &element - the value being added
+//Returns: bool - true if the value was added, false if it was already
+//         stored
+//Does: Adds the value to its shard while holding that shard's lock
+template<typename ElemType, int Shards, typename Compare, typename Hash>
+bool ShardedSet<ElemType, Shards, Compare, Hash>::insert(const ElemType &element)
+{
+        Shard &shard = shards[shard_of(element)];
+        lock_guard<mutex> guard(shard.lock);
+        return shard.tree.insert_unique(element);
+}
+
+//remove function
+//Parameters: const ElemType &element - the value being removed
+//Returns: bool - true if the value was removed, false if it was not
+//         stored
+//Does: Removes the value from its shard while holding that shard's lock
+template<typename ElemType, int Shards, typename Compare, typename Hash>
+bool ShardedSet<ElemType, Shards, Compare, Hash>::remove(const ElemType &element)
+{
+        Shard &shard = shards[shard_of(element)];
+        lock_guard<mutex> guard(shard.lock);
+        return shard.tree.remove(element);
+}
+
+//insert_many function
+//Parameters: const ElemType *elements - the values being added
+//            int n - the number of values
+//Returns: int - how many of the values were not already stored
+//Does: Groups the batch by shard and visits each shard once, holding
+//      its lock while all of its values are added
+template<typename ElemType, int Shards, typename Compare, typename Hash>
+int ShardedSet<ElemType, Shards, Compare, Hash>::insert_many(const ElemType *elements, int n)
+{
+        vector<ElemType> grouped;
+        vector<int> order;
+        int starts[Shards + 1];
+        group_by_shard(elements, n, grouped, order, starts);
+        int added = 0;
+        for (int s = 0; s < Shards; s++)
+        {
+                if (starts[s] == starts[s+1])
+                {
+                        continue;
+                }
+                lock_guard<mutex> guard(shards[s].lock);
+                for (int j = starts[s]; j < starts[s+1]; j++)
+                {
+                        if (shards[s].tree.insert_unique(grouped[j]))
+                        {
+                                added++;
+                        }
+                }
+        }
+        return added;
+}
+
+//contains_many function
+//Parameters: const ElemType *keys - the values being checked for
+//            int n - the number of keys
+//            bool *out - n flags, out[i] is set to whether keys[i] is
+//                        stored in the set
+//Returns: int - how many of the keys are stored
+//Does: Groups the batch by shard, then runs each shard's keys through
+//      AVL::contains_batch under one lock and scatters the results back
+//      to the batch order
+template<typename ElemType, int Shards, typename Compare, typename Hash>
+int ShardedSet<ElemType, Shards, Compare, Hash>::contains_many(const ElemType *keys, int n, bool *out)
+{
+        vector<ElemType> grouped;
+        vector<int> order;
+        int starts[Shards + 1];
+        group_by_shard(keys, n, grouped, order, starts);
+        bool *found = new bool[n > 0 ? n : 1];
+        for (int s = 0; s < Shards; s++)
+        {
+                int count = starts[s+1] - starts[s];
+                if (count == 0)
+                {
+                        continue;
+                }
+                lock_guard<mutex> guard(shards[s].lock);
+                shards[s].tree.contains_batch(&grouped[starts[s]], count,
+                                              &found[starts[s]]);
+        }
+        int total = 0;
+        for (int j = 0; j < n; j++)
+        {
+                out[order[j]] = found[j];
+                total += found[j];
+        }
+        delete [] found;
+        return total;
+}
+
+//range function
+//Parameters: const ElemType &lo, const ElemType &hi - bounds of the
+//            range (both inclusive)
+//            std::vector<ElemType> &out - the elements are appended here
+//Returns: int - the number of elements appended
+//Does: Locks every shard that can hold part of the range (always in
+//      shard order, so two scans cannot deadlock), copies out each
+//      shard's sorted run and releases the locks, so the result is a
+//      consistent snapshot. In range mode the runs are already in shard
+//      order and are appended one after another; in hash mode they are
+//      k-way merged
+template<typename ElemType, int Shards, typename Compare, typename Hash>
+int ShardedSet<ElemType, Shards, Compare, Hash>::range(const ElemType &lo, const ElemType &hi, vector<ElemType> &out)
+{
+        size_t before = out.size();
+        if (compare(hi, lo) < 0)
+        {
+                return 0;
+        }
+        int first = 0;
+        int last = Shards - 1;
+        if (partition == RANGE_SHARDS)
+        {
+                first = shard_of(lo);
+                last = shard_of(hi);
+        }
+        for (int s = first; s <= last; s++)
+        {
+                shards[s].lock.lock();
+        }
+        vector<ElemType> runs[Shards];
+        for (int s = first; s <= last; s++)
+        {
+                if (partition == RANGE_SHARDS)
+                {
+                        shards[s].tree.elements_in_range(lo, hi, out);
+                }
+                else
+                {
+                        shards[s].tree.elements_in_range(lo, hi, runs[s]);
+                }
+        }
+        for (int s = first; s <= last; s++)
+        {
+                shards[s].lock.unlock();
+        }
+        if (partition == HASH_SHARDS)
+        {
+                merge_runs(runs, Shards, out);
+        }
+        return out.size() - before;
+}
+
+//size function
+//Parameters: Nothing
+//Returns: int - the number of elements stored
+//Does: Adds up the shard sizes, taking each lock in turn, so the total
+//      is only exact while no other thread is writing
+template<typename ElemType, int Shards, typename Compare, typename Hash>
+int ShardedSet<ElemType, Shards, Compare, Hash>::size()
+{
+        int total = 0;
+        for (int s = 0; s < Shards; s++)
+        {
+                lock_guard<mutex> guard(shards[s].lock);
+                total += shards[s].tree.node_count();
+        }
+        return total;
+}
+
+//mode function
+//Parameters: Nothing
+//Returns: ShardMode - HASH_SHARDS or RANGE_SHARDS
+//Does: Returns how the set assigns keys to shards
+template<typename ElemType, int Shards, typename Compare, typename Hash>
+ShardMode ShardedSet<ElemType, Shards, Compare, Hash>::mode()
+{
+        return partition;
+}
+
+//init_split function (private)
+//Parameters: const ElemType *split_points - Shards - 1 keys
+//Returns: Nothing
+//Does: Switches the set to range mode and stores the split points,
+//      throws if they are not strictly ascending
+template<typename ElemType, int Shards, typename Compare, typename Hash>
+void ShardedSet<ElemType, Shards, Compare, Hash>::init_split(const ElemType *split_points)
+{
+        partition = RANGE_SHARDS;
+        split.assign(split_points, split_points + Shards - 1);
+        for (int i = 1; i < Shards - 1; i++)
+        {
+                if (compare(split[i-1], split[i]) >= 0)
+                {
+                        throw runtime_error("ShardedSet split points must "
+                                                "be strictly ascending");
+                }
+        }
+}
+
+//shard_of function (private)
+//Parameters: const ElemType &element - the value being placed
+//Returns: int - the index of the shard the value belongs to
+//Does: In hash mode, scrambles the hash with a multiplicative step so
+//      identity hashes of nearby integers still spread over the shards.
+//      In range mode, binary searches for the first split point after
+//      the value
+template<typename ElemType, int Shards, typename Compare, typename Hash>
+int ShardedSet<ElemType, Shards, Compare, Hash>::shard_of(const ElemType &element)
+{
+        if (partition == HASH_SHARDS)
+        {
+                uint64_t h = (uint64_t)hash(element) * 0x9E3779B97F4A7C15ull;
+                return (int)((h >> 32) % Shards);
+        }
+        int low = 0;
+        int high = Shards - 1;
+        while (low < high)
+        {
+                int mid = (low + high) / 2;
+                if (compare(element, split[mid]) < 0)
+                {
+                        high = mid;
+                }
+                else
+                {
+                        low = mid + 1;
+                }
+        }
+        return low;
+}
+
+//group_by_shard function (private)
+//Parameters: const ElemType *elements - the batch
+//            int n - the number of elements in the batch
+//            std::vector<ElemType> &grouped - filled with the batch
+//                                             ordered by shard
+//            std::vector<int> &order - filled with the batch index of
+//                                      each entry of grouped
+//            int *starts - Shards + 1 entries, starts[s] through
+//                          starts[s+1] - 1 are shard s's positions
+//Returns: Nothing
+//Does: Counting sort of the batch by shard index, done before any lock
+//      is taken
+template<typename ElemType, int Shards, typename Compare, typename Hash>
+void ShardedSet<ElemType, Shards, Compare, Hash>::group_by_shard(const ElemType *elements, int n,
+                        vector<ElemType> &grouped, vector<int> &order, int *starts)
+{
+        vector<int> shard_ids(n);
+        for (int s = 0; s <= Shards; s++)
+        {
+                starts[s] = 0;
+        }
+        for (int i = 0; i < n; i++)
+        {
+                shard_ids[i] = shard_of(elements[i]);
+                starts[shard_ids[i] + 1]++;
+        }
+        for (int s = 0; s < Shards; s++)
+        {
+                starts[s+1] += starts[s];
+        }
+        int next[Shards];
+        for (int s = 0; s < Shards; s++)
+        {
+                next[s] = starts[s];
+        }
+        grouped.resize(n);
+        order.resize(n);
+        for (int i = 0; i < n; i++)
+        {
+                int j = next[shard_ids[i]]++;
+                grouped[j] = elements[i];
+                order[j] = i;
+        }
+}
+
+//merge_runs function (private)
+//Parameters: std::vector<ElemType> *runs - sorted runs, one per shard
+//            int count - the number of runs
+//            std::vector<ElemType> &out - the merged result is appended
+//Returns: Nothing
+//Does: k-way merge through a binary heap of run heads, O(m log k) for m
+//      elements in k runs
+template<typename ElemType, int Shards, typename Compare, typename Hash>
+void ShardedSet<ElemType, Shards, Compare, Hash>::merge_runs(vector<ElemType> *runs, int count, vector<ElemType> &out)
+{
+        //a heap entry is the run a head belongs to and its position
+        typedef pair<int, size_t> Head;
+        Compare &comp = compare;
+        //heaps put the largest entry first, so order by "after"
+        auto after = [runs, &comp](const Head &a, const Head &b)
+        {
+                return comp(runs[a.first][a.second],
+                            runs[b.first][b.second]) > 0;
+        };
+        vector<Head> heads;
+        size_t total = 0;
+        for (int r = 0; r < count; r++)
+        {
+                total += runs[r].size();
+                if (!runs[r].empty())
+                {
+                        heads.push_back(Head(r, 0));
+                }
+        }
+        out.reserve(out.size() + total);
+        make_heap(heads.begin(), heads.end(), after);
+        while (!heads.empty())
+        {
+                pop_heap(heads.begin(), heads.end(), after);
+                Head &head = heads.back();
+                out.push_back(runs[head.first][head.second]);
+                head.second++;
+                if (head.second < runs[head.first].size())
+                {
+                        push_heap(heads.begin(), heads.end(), after);
+                }
+                else
+                {
+                        heads.pop_back();
+                }
+        }
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+/*
+ *
+ * Sharded Set Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * ShardedSet.h
+ * Class Header and Declaration
+ *
+ * Thread safe set that splits its keys across Shards AVL trees, each
+ * guarded by its own mutex, so threads working on different shards never
+ * wait on each other. Keys are assigned to shards either by hash, which
+ * spreads any key distribution evenly, or by range against Shards - 1
+ * ascending split points, which keeps each shard a contiguous slice of
+ * the key space. Every shard sits on its own cache lines so one shard's
+ * lock traffic does not slow down its neighbours. insert_many and
+ * contains_many group a batch by shard and take each lock once per batch
+ * instead of once per key, and range scans merge the sorted runs of the
+ * shards into one sorted result.
+ *
+ */
+
+#ifndef SHARDEDSET_H_
+#define SHARDEDSET_H_
+
+#include "AVL.h"
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+//how a ShardedSet assigns keys to shards
+enum ShardMode {HASH_SHARDS, RANGE_SHARDS};
+
+template<typename ElemType, int Shards = 16, typename Compare = ThreeWayCompare,
+         typename Hash = std::hash<ElemType> >
+class ShardedSet
+{
+        public:
+                //Constructor, hash partitioned
+                ShardedSet();
+                //Split Point Constructor, range partitioned
+                ShardedSet(const ElemType *split_points);
+                //Comparator and Split Point Constructor, range partitioned
+                ShardedSet(const Compare &comp, const ElemType *split_points);
+                //the shards hold mutexes, so the set cannot be copied
+                ShardedSet(const ShardedSet &rhs) = delete;
+                ShardedSet &operator=(const ShardedSet &rhs) = delete;
+                //checks if an element is stored in the set
+                bool contains(const ElemType &element);
+                //adds an element, returns false if it was already stored
+                bool insert(const ElemType &element);
+                //removes an element, returns false if it was not stored
+                bool remove(const ElemType &element);
+                //adds n elements, returns how many were not already stored
+                int insert_many(const ElemType *elements, int n);
+                //checks n keys at once, out[i] is set to whether keys[i]
+                //is stored, returns how many are stored
+                int contains_many(const ElemType *keys, int n, bool *out);
+                //appends every element in [lo, hi] to out in order,
+                //returns how many were appended
+                int range(const ElemType &lo, const ElemType &hi,
+                          std::vector<ElemType> &out);
+                //returns the number of elements stored
+                int size();
+                //returns which partitioning the set uses
+                ShardMode mode();
+
+        private:
+
+                static_assert(Shards > 0, "ShardedSet needs at least one shard");
+
+                //one partition of the set, aligned so no two shards share
+                //a cache line
+                struct alignas(64) Shard
+                {
+                        //guards tree
+                        std::mutex lock;
+                        //the elements assigned to this shard
+                        AVL<ElemType, Compare> tree;
+                };
+
+                //the partitions
+                Shard shards[Shards];
+                //HASH_SHARDS or RANGE_SHARDS
+                ShardMode partition;
+                //in range mode, shard i holds the keys from split[i-1]
+                //up to but not including split[i]
+                std::vector<ElemType> split;
+                //orders the elements and the split points
+                Compare compare;
+                //hashes the elements in hash mode
+                Hash hash;
+
+                //copies and checks the split points of a range set
+                void init_split(const ElemType *split_points);
+                //returns the shard an element belongs to
+                int shard_of(const ElemType &element);
+                //sorts a batch by shard, starts[s] is the first position
+                //of shard s in grouped and order[j] is the batch index of
+                //grouped[j]
+                void group_by_shard(const ElemType *elements, int n,
+                                    std::vector<ElemType> &grouped,
+                                    std::vector<int> &order, int *starts);
+                //merges the sorted runs of several shards into out
+                void merge_runs(std::vector<ElemType> *runs, int count,
+                                std::vector<ElemType> &out);
+};
+
+#endif
\ No newline at end of file
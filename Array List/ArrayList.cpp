@@ -9,6 +9,9 @@
  * 
  */
 
+#ifndef ARRAYLIST_CPP_
+#define ARRAYLIST_CPP_
+
 #include "ArrayList.h"
 
 #include <iostream>
@@ -20,25 +23,22 @@ using namespace std;
 //Parameters: Nothing
 //Returns: Nothing
 //Does: Initializes an empty instance of the ArrayList class
-template<typename ElemType>
-ArrayList<ElemType>::ArrayList() 
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+ArrayList<ElemType, InlineCapacity, StatsPolicy>::ArrayList() 
 {
         num_items = 0;
-        max_capacity = 0;
-        array = nullptr;
-
+        init_storage(0);
 }
 
 //initial capacity constructor 
 //Parameters: int initial_capacity, initial array size
 //Returns: Nothing
 //Does: Initializes an array given an initial capacity 
-template<typename ElemType>
-ArrayList<ElemType>::ArrayList(int initial_capacity) 
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+ArrayList<ElemType, InlineCapacity, StatsPolicy>::ArrayList(int initial_capacity) 
 {
         num_items = 0;
-        max_capacity = initial_capacity;
-        array = new ElemType[max_capacity];
+        init_storage(initial_capacity);
 }
 
 //array constructor 
@@ -47,15 +47,14 @@ ArrayList<ElemType>::ArrayList(int initial_capacity)
 //Returns: Nothing
 //Does: Initializes an instance using a passed in array and 
 //      the length
-template<typename ElemType>
-ArrayList<ElemType>::ArrayList(ElemType *temp_array, int size)
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+ArrayList<ElemType, InlineCapacity, StatsPolicy>::ArrayList(ElemType *temp_array, int size)
 {
-        array = new ElemType[size];
+        init_storage(size);
         num_items = size;
         for (int i = 0; i < size; i++) {
                 array[i] = temp_array[i];
         }
-        max_capacity = num_items;
 }
 
 //copy constructor 
@@ -63,15 +62,14 @@ ArrayList<ElemType>::ArrayList(ElemType *temp_array, int size)
 //Returns: Nothing
 //Does: Creates new instance of the ArrayList Class and copies
 //      the values stored in object passed in
-template<typename ElemType>
-ArrayList<ElemType>::ArrayList(const ArrayList &rhs)
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+ArrayList<ElemType, InlineCapacity, StatsPolicy>::ArrayList(const ArrayList &rhs)
 {
         num_items = rhs.num_items;
-        array = new ElemType[num_items];
-        max_capacity = num_items;
+        init_storage(num_items);
         for (int i = 0; i < num_items; i++) 
         {
-                array[i] = rhs.array[i];
+                array[i] = rhs.array[rhs.head + i];
         }
 }
 
@@ -79,11 +77,11 @@ ArrayList<ElemType>::ArrayList(const ArrayList &rhs)
 //Parameters: Nothing
 //Returns: Nothing
 //Does: Deletes dynamically allocated memory
-template<typename ElemType>
-ArrayList<ElemType>::~ArrayList()
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+ArrayList<ElemType, InlineCapacity, StatsPolicy>::~ArrayList()
 {
         num_items = max_capacity = -1;
-        delete [] array;
+        release_storage();
         array = NULL;
 }
 
@@ -92,19 +90,22 @@ ArrayList<ElemType>::~ArrayList()
 //Returns: ArrayList<ElemType>
 //Does: Copies all values stored in the passed in object into the
 //      current object
-template<typename ElemType>
-ArrayList<ElemType> &ArrayList<ElemType>::operator=(const ArrayList &rhs)
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+ArrayList<ElemType, InlineCapacity, StatsPolicy> &
+ArrayList<ElemType, InlineCapacity, StatsPolicy>::operator=(const ArrayList &rhs)
 {
         if (this == &rhs)
         {
                 return *this;
         }
+        if (rhs.num_items > max_capacity)
+        {
+                release_storage();
+                init_storage(rhs.num_items);
+        }
         num_items = rhs.num_items;
-        max_capacity = rhs.max_capacity;
-
-        delete [] array;
-        array = new ElemType[max_capacity];
-        copy_array(rhs.array, array, num_items);
+        head = 0;
+        copy_array(rhs.array + rhs.head, array, num_items);
         return *this;
 }
 
@@ -112,8 +113,8 @@ ArrayList<ElemType> &ArrayList<ElemType>::operator=(const ArrayList &rhs)
 //Paramters: Nothing
 //Returns: bool
 //Does: Checks if the ArrayList is empty
-template<typename ElemType>
-bool ArrayList<ElemType>::is_empty()
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+bool ArrayList<ElemType, InlineCapacity, StatsPolicy>::is_empty()
 {
         if (num_items == 0)
         {
@@ -126,18 +127,19 @@ bool ArrayList<ElemType>::is_empty()
 //Parameters: Nothing
 //Returns: Nothing
 //Does: clears the ArrayList
-template<typename ElemType>
-void ArrayList<ElemType>::clear()
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void ArrayList<ElemType, InlineCapacity, StatsPolicy>::clear()
 {
         num_items = 0;
+        head = 0;
 }
 
 //size function
 //Parameters: Nothing
 //Returns: int, the current size of the ArrayList
 //Does: Returns the number of items stored in the ArrayList
-template<typename ElemType>
-int ArrayList<ElemType>::size()
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+int ArrayList<ElemType, InlineCapacity, StatsPolicy>::size()
 {
         return num_items;
 }
@@ -146,54 +148,67 @@ int ArrayList<ElemType>::size()
 //Parameters: Nothing
 //Returns: ElemType
 //Does: Returns the first item stored in the ArrayList
-template<typename ElemType>
-ElemType ArrayList<ElemType>::first()
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+ElemType ArrayList<ElemType, InlineCapacity, StatsPolicy>::first()
 {
         if (num_items < 1)
         {
                 throw runtime_error("Cannot get first of "
                                         "empty ArrayList");
         }
-        return array[0];
+        return array[head];
 }
 
 //last function
 //Parameters: Nothing
 //Returns: ElemType
 //Does: Returns the last item stored in the ArrayList
-template<typename ElemType>
-ElemType ArrayList<ElemType>::last()
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+ElemType ArrayList<ElemType, InlineCapacity, StatsPolicy>::last()
 {
         if (num_items < 1)
         {
                 throw runtime_error("Cannot get last of " 
                                         "empty ArrayList");
         }
-        return array[num_items-1];
+        return array[head+num_items-1];
 }
 
 //element_at function
 //Paramters: int index, index being accessed
 //Returns: Elemtype
 //Does: Returns the item stored at the passed in index value
-template<typename ElemType>
-ElemType ArrayList<ElemType>::element_at(int index)
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+ElemType ArrayList<ElemType, InlineCapacity, StatsPolicy>::element_at(int index)
 {
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
         ensure_in_range(index,0,num_items-1);
-        return array[index];
+        return array[head+index];
+}
+
+//operator[]
+//Parameters: int index, index being accessed
+//Returns: ElemType & - the element stored at the index
+//Does: Gives direct access to an element for callers that have already
+//      checked the index (e.g. the heap in PriorityQueue), skipping the
+//      range check and copy made by element_at
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+ElemType &ArrayList<ElemType, InlineCapacity, StatsPolicy>::operator[](int index)
+{
+        return array[head+index];
 }
 
 //print function
 //Parameters: Nothing
 //Returns: Nothing
 //Does: Prints the current contents in the ArrayList
-template<typename ElemType>
-void ArrayList<ElemType>::print()
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void ArrayList<ElemType, InlineCapacity, StatsPolicy>::print()
 {
         cout << "[ArrayList of size " << num_items << " <<";
                 for (int i = 0; i < num_items; i++)
         {
-                cout << array[i];
+                cout << array[head+i];
         }
         cout << ">>]" << endl;
 }
@@ -202,24 +217,27 @@ void ArrayList<ElemType>::print()
 //Parameters: ElemType element, item being added to the ArrayList
 //Returns: Nothing
 //Does: Adds a passed in element to the back of the ArrayList
-template<typename ElemType>
-void ArrayList<ElemType>::push_at_back(ElemType element)
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void ArrayList<ElemType, InlineCapacity, StatsPolicy>::push_at_back(ElemType element)
 {
-        ensure_capacity(num_items+1);
-        array[num_items] = element;
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
+        ensure_capacity(false);
+        array[head+num_items] = element;
         num_items++;
 }
 
 //push_at_front function
 //Parameters: ElemType element, item being added to the ArrayList
 //Returns: Nothing
-//Does: Adds a passed in element to the front of the ArrayList
-template<typename ElemType>
-void ArrayList<ElemType>::push_at_front(ElemType element)
+//Does: Adds a passed in element to the front of the ArrayList, using
+//      the free slot before the first element
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void ArrayList<ElemType, InlineCapacity, StatsPolicy>::push_at_front(ElemType element)
 {
-        ensure_capacity(num_items+1);
-        shift_right(num_items,0);
-        array[0] = element;
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
+        ensure_capacity(true);
+        head--;
+        array[head] = element;
         num_items++;
 }
 
@@ -228,14 +246,26 @@ void ArrayList<ElemType>::push_at_front(ElemType element)
 //            int index, index being accessed
 //Returns: Nothing
 //Does: Adds the passed in element to the passed in index 
-//      of the ArrayList
-template<typename ElemType>
-void ArrayList<ElemType>::insert_at(ElemType element, int index)
+//      of the ArrayList, moving the elements before the index one
+//      slot left or the elements after it one slot right, whichever
+//      moves fewer
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void ArrayList<ElemType, InlineCapacity, StatsPolicy>::insert_at(ElemType element, int index)
 {
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
         ensure_in_range(index,0,num_items);
-        ensure_capacity(num_items+1);
-        shift_right(num_items, index);
-        array[index] = element;
+        if (index < num_items - index)
+        {
+                ensure_capacity(true);
+                head--;
+                shift_left(head, head+index);
+        }
+        else
+        {
+                ensure_capacity(false);
+                shift_right(head+num_items, head+index);
+        }
+        array[head+index] = element;
         num_items++;
 }
 
@@ -244,37 +274,36 @@ void ArrayList<ElemType>::insert_at(ElemType element, int index)
 //Returns: Nothing
 //Does: Adds the passed in element to the ArrayList in ascending
 //      order
-template<typename ElemType>
-void ArrayList<ElemType>::insert_in_order(ElemType element)
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void ArrayList<ElemType, InlineCapacity, StatsPolicy>::insert_in_order(ElemType element)
 {
-        ensure_capacity(num_items+1);
-        for (int i = 0; i < num_items; i++)
+        int index = 0;
+        while (index < num_items)
         {
-                if (element < array[i])
+                StatsPolicy::comparison();
+                if (element < array[head+index])
                 {
-                        shift_right(num_items, i);
-                        array[i] = element;
-                        num_items++;
-                        return;
+                        break;
                 }
+                index++;
         }
-        array[num_items] = element;
-        num_items++;
+        insert_at(element, index);
 }
 
 //pop_from_front function
 //Parameters: Nothing
 //Returns: Nothing
 //Does: Removes the first element from the ArrayList
-template<typename ElemType>
-void ArrayList<ElemType>::pop_from_front()
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void ArrayList<ElemType, InlineCapacity, StatsPolicy>::pop_from_front()
 {
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
         if (num_items < 1)
         {
                 throw runtime_error("Cannot pop from " 
                                         "empty ArrayList");
         }
-        shift_left(0,num_items-1);
+        head++;
         num_items--;
 }
 
@@ -282,9 +311,10 @@ void ArrayList<ElemType>::pop_from_front()
 //Parameters: Nothing
 //Returns: Nothing
 //Does: Removes the last element stored in the ArrayList
-template<typename ElemType>
-void ArrayList<ElemType>::pop_from_back()
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void ArrayList<ElemType, InlineCapacity, StatsPolicy>::pop_from_back()
 {
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
         if (num_items < 1)
         {
                 throw runtime_error("Cannot pop from " 
@@ -296,12 +326,22 @@ void ArrayList<ElemType>::pop_from_back()
 //remove_at function
 //Parameters: int index, index being accessed
 //Returns: Nothing
-//Does: Removes the element stored at a specific index
-template<typename ElemType>
-void ArrayList<ElemType>::remove_at(int index)
+//Does: Removes the element stored at a specific index, closing the
+//      hole from whichever side moves fewer elements
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void ArrayList<ElemType, InlineCapacity, StatsPolicy>::remove_at(int index)
 {
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
         ensure_in_range(index, 0, num_items-1);
-        shift_left(index, num_items-1);
+        if (index < num_items - 1 - index)
+        {
+                shift_right(head+index, head);
+                head++;
+        }
+        else
+        {
+                shift_left(head+index, head+num_items-1);
+        }
         num_items--;
 }
 
@@ -311,33 +351,79 @@ void ArrayList<ElemType>::remove_at(int index)
 //Returns: Nothing
 //Does: Replaces the element stored at a specific element
 //      with the ElemType passed into the function
-template<typename ElemType>
-void ArrayList<ElemType>::replace_at(ElemType element, int index)
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void ArrayList<ElemType, InlineCapacity, StatsPolicy>::replace_at(ElemType element, int index)
 {
         ensure_in_range(index, 0, num_items-1);
-        array[index] = element;
+        array[head+index] = element;
 }
 
 //ensure_capacity function
-//Parameters: int desired_capacity, amount of memory needed
+//Parameters: bool at_front, whether the free slot is needed before the
+//            first element (true) or after the last one (false)
 //Returns: Nothing
-//Does: Checks if ArrayList has desired memory allocation
-template<typename ElemType>
-void ArrayList<ElemType>::ensure_capacity(int desired_capacity)
+//Does: Makes sure there is a free slot on the requested side. When that
+//      side is full but at least half the array is free the elements are
+//      moved to the middle of the array, otherwise the array is doubled
+//      and the new free space goes to the side that ran out. Either way
+//      the next O(n) pushes on that side are free, so pushes stay
+//      amortized O(1) and a queue-like push_at_back/pop_from_front
+//      pattern does not keep growing the array
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void ArrayList<ElemType, InlineCapacity, StatsPolicy>::ensure_capacity(bool at_front)
 {
-        if (num_items > desired_capacity)
+        int back_free = max_capacity - head - num_items;
+        if ((at_front and head > 0) or (!at_front and back_free > 0))
         {
                 return;
         }
+        if (num_items < max_capacity / 2)
+        {
+                int new_head = (max_capacity - num_items) / 2;
+                if (new_head < head)
+                {
+                        for (int i = 0; i < num_items; i++)
+                        {
+                                array[new_head+i] = array[head+i];
+                        }
+                }
+                else
+                {
+                        for (int i = num_items - 1; i >= 0; i--)
+                        {
+                                array[new_head+i] = array[head+i];
+                        }
+                }
+                head = new_head;
+                return;
+        }
+        int new_capacity = 2 * max_capacity;
+        if (new_capacity < num_items + 1)
+        {
+                new_capacity = num_items + 1;
+        }
+        int new_free = new_capacity - num_items;
+        int new_head;
+        if (at_front)
+        {
+                int keep_back = back_free < new_free / 2 ? back_free : new_free / 2;
+                new_head = new_free - keep_back;
+        }
+        else
+        {
+                new_head = head < new_free / 2 ? head : new_free / 2;
+        }
+        StatsPolicy::reallocation();
         ElemType *new_array = NULL;
-        new_array = new ElemType[desired_capacity];
-        max_capacity = desired_capacity;
+        new_array = new ElemType[new_capacity];
         for (int i = 0; i < num_items; i++)
         {
-                new_array[i] = array[i];
+                new_array[new_head+i] = array[head+i];
         }
-        delete [] array;
+        release_storage();
         array = new_array;
+        max_capacity = new_capacity;
+        head = new_head;
 }
 
 //ensure_in_range function
@@ -346,8 +432,8 @@ void ArrayList<ElemType>::ensure_capacity(int desired_capacity)
 //            int high, highest index possible
 //Returns: Nothing
 //Does: Checks if a index is within the passed in high and low values
-template<typename ElemType>
-void ArrayList<ElemType>::ensure_in_range(int index, int low, int high)
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void ArrayList<ElemType, InlineCapacity, StatsPolicy>::ensure_in_range(int index, int low, int high)
 {
         if (index < low or index > high)
         {
@@ -361,8 +447,8 @@ void ArrayList<ElemType>::ensure_in_range(int index, int low, int high)
 //Returns: Nothing
 //Does: Shifts elements to the right from the begin index
 //      to the end index
-template<typename ElemType>
-void ArrayList<ElemType>::shift_right(int begin, int end)
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void ArrayList<ElemType, InlineCapacity, StatsPolicy>::shift_right(int begin, int end)
 {
         for (int i = begin; i > end; i--)
         {
@@ -376,8 +462,8 @@ void ArrayList<ElemType>::shift_right(int begin, int end)
 //Returns: Nothing
 //Does: Shifts elements to the left within the bounds 
 //      passed into the function
-template<typename ElemType>
-void ArrayList<ElemType>::shift_left(int begin, int end)
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void ArrayList<ElemType, InlineCapacity, StatsPolicy>::shift_left(int begin, int end)
 {
         for (int i = begin; i < end; i++)
         {
@@ -391,12 +477,55 @@ void ArrayList<ElemType>::shift_left(int begin, int end)
 //            int length, the length of the array 
 //Returns: Nothing
 //Does: Copies the contents of an array from one to another
-template<typename ElemType>
-void ArrayList<ElemType>::copy_array(ElemType from[], 
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void ArrayList<ElemType, InlineCapacity, StatsPolicy>::copy_array(ElemType from[], 
                                         ElemType to[], int length)
 {
         for (int i = 0; i < length; ++i)
                 to[i] = from[i];
 }
 
+//init_storage function
+//Parameters: int capacity, number of elements the storage must hold
+//Returns: Nothing
+//Does: Uses the inline array when the capacity fits in it, otherwise
+//      allocates a heap array of exactly the given capacity
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void ArrayList<ElemType, InlineCapacity, StatsPolicy>::init_storage(int capacity)
+{
+        head = 0;
+        if (capacity <= InlineCapacity)
+        {
+                array = inline_array;
+                max_capacity = InlineCapacity;
+                return;
+        }
+        array = new ElemType[capacity];
+        max_capacity = capacity;
+}
+
+//release_storage function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Deletes the array unless it is the inline array
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void ArrayList<ElemType, InlineCapacity, StatsPolicy>::release_storage()
+{
+        if (array != inline_array)
+        {
+                delete [] array;
+        }
+}
+
+//stats function
+//Parameters: Nothing
+//Returns: StatsSnapshot - copy of the counters kept by the StatsPolicy
+//Does: Reports reallocations and per operation latencies (all zero
+//      unless the ArrayList is built with OpStats)
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+StatsSnapshot ArrayList<ElemType, InlineCapacity, StatsPolicy>::stats()
+{
+        return StatsPolicy::snapshot();
+}
 
+#endif
\ No newline at end of file
@@ -12,8 +12,18 @@
 #ifndef ARRAYLIST_H_
 #define ARRAYLIST_H_
 
-template<typename ElemType>
-class ArrayList
+#include "../Instrumentation/OpStats.h"
+
+//InlineCapacity elements are stored inside the ArrayList object itself,
+//so lists that never grow past it never touch the heap
+//
+//The elements live in array[head] through array[head+num_items-1], with
+//free slots kept on both sides. Pushing or popping at either end is
+//amortized O(1), and insert_at/remove_at shift whichever side of the
+//index is shorter
+template<typename ElemType, int InlineCapacity = 0,
+         typename StatsPolicy = NoStats>
+class ArrayList : private StatsPolicy
 {
         public:
                 //default constructor
@@ -42,6 +52,9 @@ class ArrayList
                 ElemType last();
                 //returns the element at the given index
                 ElemType element_at(int index);
+                //returns a reference to the element at the given index,
+                //without a range check
+                ElemType &operator[](int index);
                 //prints contents stored in the array
                 void print();
                 //adds an element to the back
@@ -60,19 +73,27 @@ class ArrayList
                 void remove_at(int index);
                 //replaces element at given index
                 void replace_at(ElemType element, int index);
+                //returns a snapshot of the operation counters
+                StatsSnapshot stats();
                 
         private:
 
-                //array of data
+                //array of data, points at inline_array until the list
+                //outgrows it
                 ElemType *array;
+                //in-object storage for the first InlineCapacity elements
+                ElemType inline_array[InlineCapacity > 0 ? InlineCapacity : 1];
+                //index in array of the first element
+                int head;
                 //current number of elements
                 int num_items;
                 //maximum number of items before increasing 
                 //memory allocation
                 int max_capacity;
 
-                //ensure enough memory is allocated
-                void ensure_capacity(int desired_capacity);
+                //ensure there is a free slot before the first element
+                //(at_front) or after the last one
+                void ensure_capacity(bool at_front);
                 //ensure given index is valid
                 void ensure_in_range(int index, int low, int high);
                 //shift elements to the right
@@ -81,6 +102,10 @@ class ArrayList
                 void shift_left(int begin, int end);
                 //copies one array into another
                 void copy_array(ElemType from[], ElemType to[], int length);
+                //points array at storage able to hold the given capacity
+                void init_storage(int capacity);
+                //frees the array if it lives on the heap
+                void release_storage();
 
 };
 
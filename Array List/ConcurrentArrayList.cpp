@@ -0,0 +1,306 @@
+/*
+ *
+ * Concurrent ArrayList Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * ConcurrentArrayList.cpp
+ * Full function implementation
+ *
+ */
+
+#include "ConcurrentArrayList.h"
+
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+using namespace std;
+
+//default constructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Initializes an empty list, no segment is allocated until the
+//      first push_back
+template<typename ElemType, int FirstSegmentBits>
+ConcurrentArrayList<ElemType, FirstSegmentBits>::ConcurrentArrayList()
+{
+        for (int k = 0; k < MAX_SEGMENTS; k++)
+        {
+                segments[k].store(nullptr, memory_order_relaxed);
+        }
+        reserved.store(0, memory_order_relaxed);
+}
+
+//destructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Destroys every element written and frees every allocated
+//      segment. No other thread may still be using the list
+template<typename ElemType, int FirstSegmentBits>
+ConcurrentArrayList<ElemType, FirstSegmentBits>::~ConcurrentArrayList()
+{
+        for (int k = 0; k < MAX_SEGMENTS; k++)
+        {
+                ReadyWord *ready = segments[k].load(memory_order_relaxed);
+                if (ready == nullptr)
+                {
+                        continue;
+                }
+                ElemType *elements = elements_of(ready, k);
+                for (size_t i = 0; i < segment_length(k); i++)
+                {
+                        if (is_set(ready, i, memory_order_relaxed))
+                        {
+                                elements[i].~ElemType();
+                        }
+                }
+                free(ready);
+        }
+}
+
+//is_empty function
+//Parameters: Nothing
+//Returns: bool
+//Does: Checks if no element has been pushed yet
+template<typename ElemType, int FirstSegmentBits>
+bool ConcurrentArrayList<ElemType, FirstSegmentBits>::is_empty()
+{
+        return size() == 0;
+}
+
+//size function
+//Parameters: Nothing
+//Returns: int, the number of indices handed out
+//Does: Returns how many push_back calls have reserved an index. The
+//      newest of those elements may still be being written, which
+//      element_at waits for and is_ready reports
+template<typename ElemType, int FirstSegmentBits>
+int ConcurrentArrayList<ElemType, FirstSegmentBits>::size()
+{
+        return reserved.load(memory_order_acquire);
+}
+
+//push_back function
+//Parameters: ElemType element, item being added
+//Returns: int, the index the element was stored at
+//Does: Reserves the next index with a compare and swap, so concurrent
+//      pushes never take a lock, writes the element into its slot and
+//      publishes it. The counter is never moved past INT_MAX, so size()
+//      stays non negative once the list is full. Nothing already stored
+//      is ever moved
+template<typename ElemType, int FirstSegmentBits>
+int ConcurrentArrayList<ElemType, FirstSegmentBits>::push_back(ElemType element)
+{
+        int index = reserved.load(memory_order_relaxed);
+        do
+        {
+                if (index == INT_MAX)
+                {
+                        throw runtime_error("ConcurrentArrayList is full, "
+                                                "no index left to reserve");
+                }
+        } while (!reserved.compare_exchange_weak(index, index + 1,
+                                                 memory_order_acq_rel,
+                                                 memory_order_relaxed));
+        int offset;
+        int segment = segment_of(index, offset);
+        ReadyWord *ready = segment_for_push(segment);
+        new (&elements_of(ready, segment)[offset]) ElemType(element);
+        ready[offset / 64].fetch_or(1ull << (offset % 64), memory_order_release);
+        return index;
+}
+
+//is_ready function
+//Parameters: int index, index being checked
+//Returns: bool - true once the element at index has been written
+//Does: Lets readers skip elements whose push_back has not finished
+template<typename ElemType, int FirstSegmentBits>
+bool ConcurrentArrayList<ElemType, FirstSegmentBits>::is_ready(int index)
+{
+        ensure_in_range(index, 0, size()-1);
+        int offset;
+        ReadyWord *ready = segments[segment_of(index, offset)].load(memory_order_acquire);
+        return ready != nullptr and is_set(ready, offset, memory_order_acquire);
+}
+
+//element_at function
+//Parameters: int index, index being accessed
+//Returns: ElemType
+//Does: Returns a copy of the element at the index. If the index has
+//      been reserved but its element is not written yet, yields until
+//      the pushing thread publishes it
+template<typename ElemType, int FirstSegmentBits>
+ElemType ConcurrentArrayList<ElemType, FirstSegmentBits>::element_at(int index)
+{
+        ensure_in_range(index, 0, size()-1);
+        while (!is_ready(index))
+        {
+                this_thread::yield();
+        }
+        return *slot_at(index);
+}
+
+//operator[]
+//Parameters: int index, index being accessed
+//Returns: ElemType & - the element stored at the index
+//Does: Gives direct access to an element the caller knows has been
+//      written (e.g. the index its own push_back returned). The
+//      reference stays valid until the list is destroyed
+template<typename ElemType, int FirstSegmentBits>
+ElemType &ConcurrentArrayList<ElemType, FirstSegmentBits>::operator[](int index)
+{
+        return *slot_at(index);
+}
+
+//print function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Prints the elements written so far, skipping slots still being
+//      written
+template<typename ElemType, int FirstSegmentBits>
+void ConcurrentArrayList<ElemType, FirstSegmentBits>::print()
+{
+        int length = size();
+        cout << "[ConcurrentArrayList of size " << length << " <<";
+        for (int i = 0; i < length; i++)
+        {
+                if (is_ready(i))
+                {
+                        cout << *slot_at(i);
+                }
+        }
+        cout << ">>]" << endl;
+}
+
+//segment_of function (private)
+//Parameters: int index, a non negative index
+//            int &offset, set to the index's position in its segment
+//Returns: int, the segment holding the index
+//Does: Shifting the index up by the first segment's size makes the
+//      highest set bit name the segment and the bits below it the offset
+template<typename ElemType, int FirstSegmentBits>
+int ConcurrentArrayList<ElemType, FirstSegmentBits>::segment_of(int index, int &offset)
+{
+        unsigned int position = (unsigned int)index + (1u << FirstSegmentBits);
+        int high_bit = 31 - __builtin_clz(position);
+        offset = position - (1u << high_bit);
+        return high_bit - FirstSegmentBits;
+}
+
+//segment_length function (private)
+//Parameters: int segment, a segment number
+//Returns: size_t, the number of elements the segment holds
+//Does: Doubles the first segment's size once per segment
+template<typename ElemType, int FirstSegmentBits>
+size_t ConcurrentArrayList<ElemType, FirstSegmentBits>::segment_length(int segment)
+{
+        return (size_t)1 << (FirstSegmentBits + segment);
+}
+
+//segment_for_push function (private)
+//Parameters: int segment, the segment of an index just reserved by
+//            push_back
+//Returns: ReadyWord *, the segment's ready flags
+//Does: Allocates the segment if no other push has. Racing threads each
+//      allocate one and try to install it with a compare and swap; the
+//      losers free theirs and use the winner's. Only the ready flags are
+//      constructed up front, one bit per element, so a large segment's
+//      element pages are first touched by the pushes that fill them
+//      rather than all at once by the push that allocates it
+template<typename ElemType, int FirstSegmentBits>
+typename ConcurrentArrayList<ElemType, FirstSegmentBits>::ReadyWord *ConcurrentArrayList<ElemType, FirstSegmentBits>::segment_for_push(int segment)
+{
+        ReadyWord *ready = segments[segment].load(memory_order_acquire);
+        if (ready == nullptr)
+        {
+                size_t length = segment_length(segment);
+                void *block = malloc(flag_bytes(segment) + length * sizeof(ElemType));
+                if (block == nullptr)
+                {
+                        throw bad_alloc();
+                }
+                ReadyWord *fresh = static_cast<ReadyWord *>(block);
+                for (size_t i = 0; i < (length + 63) / 64; i++)
+                {
+                        new (&fresh[i]) ReadyWord(0);
+                }
+                if (segments[segment].compare_exchange_strong(ready, fresh,
+                                                              memory_order_acq_rel))
+                {
+                        ready = fresh;
+                }
+                else
+                {
+                        free(fresh);
+                }
+        }
+        return ready;
+}
+
+//flag_bytes function (private)
+//Parameters: int segment, a segment number
+//Returns: size_t, the bytes in front of the segment's elements
+//Does: Sizes the segment's ready flags, rounded up to the element
+//      alignment so the elements that follow are aligned
+template<typename ElemType, int FirstSegmentBits>
+size_t ConcurrentArrayList<ElemType, FirstSegmentBits>::flag_bytes(int segment)
+{
+        size_t bytes = (segment_length(segment) + 63) / 64 * sizeof(ReadyWord);
+        return (bytes + alignof(ElemType) - 1) & ~(alignof(ElemType) - 1);
+}
+
+//is_set function (private)
+//Parameters: ReadyWord *ready, the start of a segment
+//            size_t offset, an element's position in the segment
+//            memory_order order, the ordering of the load
+//Returns: bool - whether the element's ready bit is set
+//Does: Loads the word holding the element's bit
+template<typename ElemType, int FirstSegmentBits>
+bool ConcurrentArrayList<ElemType, FirstSegmentBits>::is_set(ReadyWord *ready, size_t offset,
+                                                             memory_order order)
+{
+        return (ready[offset / 64].load(order) >> (offset % 64)) & 1;
+}
+
+//elements_of function (private)
+//Parameters: ReadyWord *ready, the start of a segment
+//            int segment, the segment's number
+//Returns: ElemType *, where the segment's elements start
+//Does: Skips the ready flags
+template<typename ElemType, int FirstSegmentBits>
+ElemType *ConcurrentArrayList<ElemType, FirstSegmentBits>::elements_of(ReadyWord *ready, int segment)
+{
+        return reinterpret_cast<ElemType *>(reinterpret_cast<char *>(ready) +
+                                            flag_bytes(segment));
+}
+
+//slot_at function (private)
+//Parameters: int index, an index whose segment is allocated
+//Returns: ElemType *, the storage for the index's element
+//Does: Maps the index to its segment and offset
+template<typename ElemType, int FirstSegmentBits>
+ElemType *ConcurrentArrayList<ElemType, FirstSegmentBits>::slot_at(int index)
+{
+        int offset;
+        int segment = segment_of(index, offset);
+        return &elements_of(segments[segment].load(memory_order_acquire), segment)[offset];
+}
+
+//ensure_in_range function (private)
+//Parameters: int index, index being accessed
+//            int low, lowest index possible
+//            int high, highest index possible
+//Returns: Nothing
+//Does: Checks if a index is within the passed in high and low values
+template<typename ElemType, int FirstSegmentBits>
+void ConcurrentArrayList<ElemType, FirstSegmentBits>::ensure_in_range(int index, int low, int high)
+{
+        if (index < low or index > high)
+        {
+                throw range_error("Index accessed is not in range");
+        }
+}
\ No newline at end of file
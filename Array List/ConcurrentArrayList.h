@@ -0,0 +1,103 @@
+/*
+ *
+ * Concurrent ArrayList Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * ConcurrentArrayList.h
+ * Header and function declarations
+ *
+ * Append only list that many threads can push to and read from at once
+ * without a lock. Elements live in segments that double in size (the
+ * first holds 2^FirstSegmentBits elements) and are never moved once
+ * written, so growing never copies anything and a reference to an
+ * element stays valid for the life of the list. push_back reserves its
+ * index with a compare and swap that refuses to go past INT_MAX,
+ * allocates the segment if it is the first to need it, writes the
+ * element and then sets its ready bit. A segment keeps its ready bits,
+ * packed 64 to a word, in front of its elements, so installing a
+ * segment only touches the bits and the element pages are first touched
+ * by the pushes that fill them. Readers map an index to its segment and
+ * offset with a couple of bit operations.
+ *
+ */
+
+#ifndef CONCURRENTARRAYLIST_H_
+#define CONCURRENTARRAYLIST_H_
+
+#include <atomic>
+#include <cstddef>
+
+template<typename ElemType, int FirstSegmentBits = 4>
+class ConcurrentArrayList
+{
+        public:
+                //default constructor
+                ConcurrentArrayList();
+                //destructor
+                ~ConcurrentArrayList();
+                //the list is shared between threads rather than copied
+                ConcurrentArrayList(const ConcurrentArrayList &rhs) = delete;
+                ConcurrentArrayList &operator=(const ConcurrentArrayList &rhs) = delete;
+
+                //checks if the list is empty
+                bool is_empty();
+                //returns the number of indices handed out so far
+                int size();
+                //adds an element to the back, returns its index
+                int push_back(ElemType element);
+                //checks if the element at the given index has been written
+                bool is_ready(int index);
+                //returns the element at the given index, waiting for it to
+                //be written if its push_back is still running
+                ElemType element_at(int index);
+                //returns a reference to the element at the given index,
+                //without a range or ready check
+                ElemType &operator[](int index);
+                //prints contents stored in the list
+                void print();
+
+        private:
+
+                static_assert(FirstSegmentBits >= 0 and FirstSegmentBits < 16,
+                              "FirstSegmentBits must be in [0, 16)");
+                static_assert(alignof(ElemType) <= alignof(std::max_align_t),
+                              "segments come from malloc");
+
+                //ready flags of 64 elements, bit i is set once push_back has
+                //finished writing the element at offset i
+                typedef std::atomic<unsigned long long> ReadyWord;
+
+                //enough segments to hold every non negative int index
+                static const int MAX_SEGMENTS = 32 - FirstSegmentBits;
+
+                //segment k holds a ready bit for each of its
+                //2^(FirstSegmentBits+k) elements, then the elements, each
+                //only constructed by its push_back. Null until the first
+                //push_back that lands in it
+                std::atomic<ReadyWord *> segments[MAX_SEGMENTS];
+                //the next index push_back hands out
+                std::atomic<int> reserved;
+
+                //finds the segment and offset of an index
+                int segment_of(int index, int &offset);
+                //returns the number of elements in a segment
+                static size_t segment_length(int segment);
+                //returns the bytes a segment's ready flags take up
+                static size_t flag_bytes(int segment);
+                //returns a segment's ready flags, allocating the segment if
+                //needed
+                ReadyWord *segment_for_push(int segment);
+                //checks an element's ready bit
+                static bool is_set(ReadyWord *ready, size_t offset,
+                                   std::memory_order order);
+                //returns the elements stored behind a segment's ready flags
+                static ElemType *elements_of(ReadyWord *ready, int segment);
+                //returns the element storage of an index in an allocated
+                //segment
+                ElemType *slot_at(int index);
+                //ensure given index is valid
+                void ensure_in_range(int index, int low, int high);
+};
+
+#endif
\ No newline at end of file
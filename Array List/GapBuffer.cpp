@@ -0,0 +1,336 @@
+/*
+ *
+ * Gap Buffer Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * GapBuffer.cpp
+ * Full function implementation
+ *
+ */
+
+#include "GapBuffer.h"
+
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+
+//default constructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Initializes an empty instance of the GapBuffer class
+template<typename ElemType, typename StatsPolicy>
+GapBuffer<ElemType, StatsPolicy>::GapBuffer()
+{
+        array = nullptr;
+        gap_start = gap_end = max_capacity = 0;
+}
+
+//initial capacity constructor
+//Parameters: int initial_capacity, initial array size
+//Returns: Nothing
+//Does: Initializes an empty buffer whose gap spans the whole array
+template<typename ElemType, typename StatsPolicy>
+GapBuffer<ElemType, StatsPolicy>::GapBuffer(int initial_capacity)
+{
+        array = new ElemType[initial_capacity];
+        max_capacity = gap_end = initial_capacity;
+        gap_start = 0;
+}
+
+//copy constructor
+//Parameters: const GapBuffer &rhs, second instance of the class
+//Returns: Nothing
+//Does: Creates new instance of the GapBuffer Class and copies
+//      the values stored in object passed in
+template<typename ElemType, typename StatsPolicy>
+GapBuffer<ElemType, StatsPolicy>::GapBuffer(const GapBuffer &rhs)
+{
+        array = nullptr;
+        copy_buffer(rhs);
+}
+
+//destructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Deletes dynamically allocated memory
+template<typename ElemType, typename StatsPolicy>
+GapBuffer<ElemType, StatsPolicy>::~GapBuffer()
+{
+        gap_start = gap_end = max_capacity = -1;
+        delete [] array;
+        array = nullptr;
+}
+
+//assignment operator
+//Parameters: const GapBuffer &rhs, second instance of the class
+//Returns: GapBuffer<ElemType>
+//Does: Copies all values stored in the passed in object into the
+//      current object
+template<typename ElemType, typename StatsPolicy>
+GapBuffer<ElemType, StatsPolicy> &GapBuffer<ElemType, StatsPolicy>::operator=(const GapBuffer &rhs)
+{
+        if (this == &rhs)
+        {
+                return *this;
+        }
+        delete [] array;
+        copy_buffer(rhs);
+        return *this;
+}
+
+//is_empty function
+//Paramters: Nothing
+//Returns: bool
+//Does: Checks if the GapBuffer is empty
+template<typename ElemType, typename StatsPolicy>
+bool GapBuffer<ElemType, StatsPolicy>::is_empty()
+{
+        return size() == 0;
+}
+
+//size function
+//Parameters: Nothing
+//Returns: int, the number of elements stored
+//Does: Returns the array length minus the length of the gap
+template<typename ElemType, typename StatsPolicy>
+int GapBuffer<ElemType, StatsPolicy>::size()
+{
+        return max_capacity - (gap_end - gap_start);
+}
+
+//cursor function
+//Parameters: Nothing
+//Returns: int, the index the cursor is in front of
+//Does: Returns the position edits currently happen at
+template<typename ElemType, typename StatsPolicy>
+int GapBuffer<ElemType, StatsPolicy>::cursor()
+{
+        return gap_start;
+}
+
+//element_at function
+//Paramters: int index, index being accessed
+//Returns: Elemtype
+//Does: Returns the item stored at the passed in index value
+template<typename ElemType, typename StatsPolicy>
+ElemType GapBuffer<ElemType, StatsPolicy>::element_at(int index)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        ensure_in_range(index, 0, size()-1);
+        return array[slot(index)];
+}
+
+//print function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Prints the current contents in the GapBuffer
+template<typename ElemType, typename StatsPolicy>
+void GapBuffer<ElemType, StatsPolicy>::print()
+{
+        cout << "[GapBuffer of size " << size() << " <<";
+        for (int i = 0; i < size(); i++)
+        {
+                cout << array[slot(i)];
+        }
+        cout << ">>]" << endl;
+}
+
+//move_cursor function
+//Parameters: int index, the index the cursor is moved in front of
+//Returns: Nothing
+//Does: Slides the gap to the index by copying the elements between the
+//      old and new cursor across it, O(distance moved)
+template<typename ElemType, typename StatsPolicy>
+void GapBuffer<ElemType, StatsPolicy>::move_cursor(int index)
+{
+        ensure_in_range(index, 0, size());
+        while (gap_start > index)
+        {
+                gap_start--;
+                gap_end--;
+                array[gap_end] = array[gap_start];
+        }
+        while (gap_start < index)
+        {
+                array[gap_start] = array[gap_end];
+                gap_start++;
+                gap_end++;
+        }
+}
+
+//insert function
+//Parameters: ElemType element, item being added
+//Returns: Nothing
+//Does: Writes the element into the first slot of the gap, amortized O(1)
+template<typename ElemType, typename StatsPolicy>
+void GapBuffer<ElemType, StatsPolicy>::insert(ElemType element)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
+        ensure_capacity();
+        array[gap_start] = element;
+        gap_start++;
+}
+
+//erase_before function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Removes the element before the cursor by widening the gap
+template<typename ElemType, typename StatsPolicy>
+void GapBuffer<ElemType, StatsPolicy>::erase_before()
+{
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
+        if (gap_start == 0)
+        {
+                throw runtime_error("Nothing before the cursor "
+                                        "to erase");
+        }
+        gap_start--;
+}
+
+//erase_after function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Removes the element after the cursor by widening the gap
+template<typename ElemType, typename StatsPolicy>
+void GapBuffer<ElemType, StatsPolicy>::erase_after()
+{
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
+        if (gap_end == max_capacity)
+        {
+                throw runtime_error("Nothing after the cursor "
+                                        "to erase");
+        }
+        gap_end++;
+}
+
+//insert_at function
+//Parameters: ElemType element, element being added
+//            int index, index being accessed
+//Returns: Nothing
+//Does: Moves the cursor to the index and inserts the element there
+template<typename ElemType, typename StatsPolicy>
+void GapBuffer<ElemType, StatsPolicy>::insert_at(ElemType element, int index)
+{
+        move_cursor(index);
+        insert(element);
+}
+
+//remove_at function
+//Parameters: int index, index being accessed
+//Returns: Nothing
+//Does: Moves the cursor to the index and erases the element after it
+template<typename ElemType, typename StatsPolicy>
+void GapBuffer<ElemType, StatsPolicy>::remove_at(int index)
+{
+        ensure_in_range(index, 0, size()-1);
+        move_cursor(index);
+        erase_after();
+}
+
+//replace_at function
+//Parameters: ElemType element, element being added
+//            int index, index being accessed
+//Returns: Nothing
+//Does: Replaces the element stored at a specific index without
+//      moving the cursor
+template<typename ElemType, typename StatsPolicy>
+void GapBuffer<ElemType, StatsPolicy>::replace_at(ElemType element, int index)
+{
+        ensure_in_range(index, 0, size()-1);
+        array[slot(index)] = element;
+}
+
+//stats function
+//Parameters: Nothing
+//Returns: StatsSnapshot - copy of the counters kept by the StatsPolicy
+//Does: Reports reallocations and per operation latencies (all zero
+//      unless the GapBuffer is built with OpStats)
+template<typename ElemType, typename StatsPolicy>
+StatsSnapshot GapBuffer<ElemType, StatsPolicy>::stats()
+{
+        return StatsPolicy::snapshot();
+}
+
+//ensure_capacity function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: When the gap is empty, doubles the array and puts all the new
+//      free slots into the gap, keeping the elements after the cursor
+//      at the end of the new array
+template<typename ElemType, typename StatsPolicy>
+void GapBuffer<ElemType, StatsPolicy>::ensure_capacity()
+{
+        if (gap_start < gap_end)
+        {
+                return;
+        }
+        StatsPolicy::reallocation();
+        int new_capacity = max_capacity > 0 ? 2 * max_capacity : 1;
+        int after = max_capacity - gap_end;
+        ElemType *new_array = new ElemType[new_capacity];
+        for (int i = 0; i < gap_start; i++)
+        {
+                new_array[i] = array[i];
+        }
+        for (int i = 0; i < after; i++)
+        {
+                new_array[new_capacity-after+i] = array[gap_end+i];
+        }
+        delete [] array;
+        array = new_array;
+        gap_end = new_capacity - after;
+        max_capacity = new_capacity;
+}
+
+//ensure_in_range function
+//Parameters: int index, index being accessed
+//            int low, lowest index possible
+//            int high, highest index possible
+//Returns: Nothing
+//Does: Checks if a index is within the passed in high and low values
+template<typename ElemType, typename StatsPolicy>
+void GapBuffer<ElemType, StatsPolicy>::ensure_in_range(int index, int low, int high)
+{
+        if (index < low or index > high)
+        {
+                throw range_error("Index accessed is not in range");
+        }
+}
+
+//slot function
+//Parameters: int index, index of an element
+//Returns: int, the position of the element in array
+//Does: Skips over the gap for elements after the cursor
+template<typename ElemType, typename StatsPolicy>
+int GapBuffer<ElemType, StatsPolicy>::slot(int index)
+{
+        if (index < gap_start)
+        {
+                return index;
+        }
+        return index + (gap_end - gap_start);
+}
+
+//copy_buffer function
+//Parameters: const GapBuffer &rhs, the buffer being copied
+//Returns: Nothing
+//Does: Allocates an array the size of rhs and copies its elements,
+//      gap and cursor
+template<typename ElemType, typename StatsPolicy>
+void GapBuffer<ElemType, StatsPolicy>::copy_buffer(const GapBuffer &rhs)
+{
+        max_capacity = rhs.max_capacity;
+        gap_start = rhs.gap_start;
+        gap_end = rhs.gap_end;
+        array = max_capacity > 0 ? new ElemType[max_capacity] : nullptr;
+        for (int i = 0; i < gap_start; i++)
+        {
+                array[i] = rhs.array[i];
+        }
+        for (int i = gap_end; i < max_capacity; i++)
+        {
+                array[i] = rhs.array[i];
+        }
+}
\ No newline at end of file
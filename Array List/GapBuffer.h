@@ -0,0 +1,89 @@
+/*
+ *
+ * Gap Buffer Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * GapBuffer.h
+ * Header and function declarations
+ *
+ * Array with a movable run of free slots (the gap) at the cursor. The
+ * elements before the cursor sit at the start of the array and the
+ * elements after it sit at the end. Inserting or erasing at the cursor
+ * only changes the gap, and moving the cursor by d copies d elements
+ * across the gap, so a run of edits near one spot costs O(distance moved)
+ * instead of O(n) per edit like ArrayList::insert_at.
+ *
+ */
+
+#ifndef GAPBUFFER_H_
+#define GAPBUFFER_H_
+
+#include "../Instrumentation/OpStats.h"
+
+template<typename ElemType, typename StatsPolicy = NoStats>
+class GapBuffer : private StatsPolicy
+{
+        public:
+                //default constructor
+                GapBuffer();
+                //initial capacity constructor
+                GapBuffer(int initial_capacity);
+                //copy constructor
+                GapBuffer(const GapBuffer &rhs);
+                //destructor
+                ~GapBuffer();
+
+                //assignment operator
+                GapBuffer &operator=(const GapBuffer &rhs);
+
+                //checks if the GapBuffer is empty
+                bool is_empty();
+                //returns number of items
+                int size();
+                //returns the index the cursor is in front of
+                int cursor();
+                //returns the element at the given index
+                ElemType element_at(int index);
+                //prints contents stored in the buffer
+                void print();
+                //moves the cursor in front of the given index
+                void move_cursor(int index);
+                //inserts an element at the cursor, the cursor moves past it
+                void insert(ElemType element);
+                //removes the element before the cursor
+                void erase_before();
+                //removes the element after the cursor
+                void erase_after();
+                //adds an element to the given index, moving the cursor there
+                void insert_at(ElemType element, int index);
+                //removes element from given index, moving the cursor there
+                void remove_at(int index);
+                //replaces element at given index
+                void replace_at(ElemType element, int index);
+                //returns a snapshot of the operation counters
+                StatsSnapshot stats();
+
+        private:
+
+                //array of data, the gap is array[gap_start] through
+                //array[gap_end-1]
+                ElemType *array;
+                //index of the first free slot, equal to the cursor
+                int gap_start;
+                //index of the first element after the gap
+                int gap_end;
+                //length of array
+                int max_capacity;
+
+                //ensure the gap holds at least one free slot
+                void ensure_capacity();
+                //ensure given index is valid
+                void ensure_in_range(int index, int low, int high);
+                //maps an element index to its slot in array
+                int slot(int index);
+                //copies another buffer's elements and cursor
+                void copy_buffer(const GapBuffer &rhs);
+};
+
+#endif
\ No newline at end of file
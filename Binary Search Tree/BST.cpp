@@ -14,6 +14,8 @@
 #include <stack>
 #include <queue>
 #include <limits>
+#include <cmath>
+#include <stdexcept>
 
 using namespace std;
 
@@ -21,18 +23,74 @@ using namespace std;
 //Parameters: Nothing
 //Returns: Nothing
 //Does: Initializes an instance of the Class
-template<typename ElemType>
-BST<ElemType>::BST()
+template<typename ElemType, typename Compare, typename StatsPolicy>
+BST<ElemType, Compare, StatsPolicy>::BST()
 {
+        init_tree(0);
+}
+
+//comparator constructor
+//Parameters: const Compare &comp - the comparator used to order elements
+//Returns: Nothing
+//Does: Initializes an empty instance of the Class that orders its
+//      elements with the passed in comparator
+template<typename ElemType, typename Compare, typename StatsPolicy>
+BST<ElemType, Compare, StatsPolicy>::BST(const Compare &comp)
+{
+        init_tree(0);
+        compare = comp;
+}
+
+//scapegoat constructor
+//Parameters: double balance_alpha - between 0.5 and 1, how lopsided a
+//            subtree may get before it is rebuilt
+//Returns: Nothing
+//Does: Initializes an empty tree that keeps itself balanced as a
+//      scapegoat tree. Smaller alphas keep the tree shorter at the cost
+//      of more frequent rebuilds
+template<typename ElemType, typename Compare, typename StatsPolicy>
+BST<ElemType, Compare, StatsPolicy>::BST(double balance_alpha)
+{
+        init_tree(balance_alpha);
+}
+
+//comparator and scapegoat constructor
+//Parameters: const Compare &comp - the comparator used to order elements
+//            double balance_alpha - between 0.5 and 1, how lopsided a
+//            subtree may get before it is rebuilt
+//Returns: Nothing
+//Does: Initializes an empty scapegoat tree ordered by comp
+template<typename ElemType, typename Compare, typename StatsPolicy>
+BST<ElemType, Compare, StatsPolicy>::BST(const Compare &comp, double balance_alpha)
+{
+        init_tree(balance_alpha);
+        compare = comp;
+}
+
+//init_tree function (private)
+//Parameters: double balance_alpha - the scapegoat alpha, 0 for a plain
+//            unbalanced tree
+//Returns: Nothing
+//Does: Sets up an empty tree, throwing if the alpha cannot work
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void BST<ElemType, Compare, StatsPolicy>::init_tree(double balance_alpha)
+{
+        if (balance_alpha != 0 and (balance_alpha <= 0.5 or balance_alpha >= 1))
+        {
+                throw runtime_error("scapegoat alpha must be "
+                                        "between 0.5 and 1");
+        }
         root = nullptr;
+        alpha = balance_alpha;
+        num_nodes = max_nodes = 0;
 }
 
 //destructor
 //Parameters: Nothing
 //Returns: Nothing
 //Does: Deletes all dynamically allocated memory
-template<typename ElemType>
-BST<ElemType>::~BST()
+template<typename ElemType, typename Compare, typename StatsPolicy>
+BST<ElemType, Compare, StatsPolicy>::~BST()
 {
         delete_tree(root);
 }
@@ -43,9 +101,13 @@ BST<ElemType>::~BST()
 //Returns: Nothing
 //Does: Takes in an instance of the BinarySearchTree class and makes a 
 //      deep copy of the instance 
-template<typename ElemType>
-BST<ElemType>::BST(const BST &rhs)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+BST<ElemType, Compare, StatsPolicy>::BST(const BST &rhs)
 {
+        compare = rhs.compare;
+        alpha = rhs.alpha;
+        num_nodes = rhs.num_nodes;
+        max_nodes = rhs.max_nodes;
         root = copy_tree(rhs.root);
 }
 
@@ -56,8 +118,8 @@ BST<ElemType>::BST(const BST &rhs)
 //         copied
 //Does: Makes a deep copy of the tree beginning at the passed in
 //      node
-template<typename ElemType>
-typename BST<ElemType>::Node *BST<ElemType>::copy_tree(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename BST<ElemType, Compare, StatsPolicy>::Node *BST<ElemType, Compare, StatsPolicy>::copy_tree(Node *node)
 {
         if (node != nullptr)
         {
@@ -67,23 +129,28 @@ typename BST<ElemType>::Node *BST<ElemType>::copy_tree(Node *node)
                 temp_node->count = node->count;
                 temp_node->left = copy_tree(node->left);
                 temp_node->right = copy_tree(node->right);
+                return temp_node;
         }
-        return node;
+        return nullptr;
 }
 
 //assignment operator
 //Parameters: const BST &rhs, the tree that is being copied 
 //            into the current instance
-//Returns: BST<ElemType>, the object that copied all data
+//Returns: BST<ElemType, Compare, StatsPolicy>, the object that copied all data
 //         from the source passed into the function
 //Does: Copes the tree passed into the function into the
 //      current instance of the class
-template<typename ElemType>
-BST<ElemType> &BST<ElemType>::operator=(const BST &rhs)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+BST<ElemType, Compare, StatsPolicy> &BST<ElemType, Compare, StatsPolicy>::operator=(const BST &rhs)
 {
         if (this != &rhs)
         {
                 delete_tree(root);
+                compare = rhs.compare;
+                alpha = rhs.alpha;
+                num_nodes = rhs.num_nodes;
+                max_nodes = rhs.max_nodes;
                 root = copy_tree(rhs.root);
         }
         return *this;
@@ -95,8 +162,8 @@ BST<ElemType> &BST<ElemType>::operator=(const BST &rhs)
 //Returns: Nothing
 //Does: Using a post-order traversal, deletes all nodes 
 //      stored in the tree
-template<typename ElemType>
-void BST<ElemType>::delete_tree(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void BST<ElemType, Compare, StatsPolicy>::delete_tree(Node *node)
 {
         if (node == nullptr)
         {
@@ -108,31 +175,51 @@ void BST<ElemType>::delete_tree(Node *node)
 }
 
 //contains Function 
-//Paramters: ElemType element - the value being checked for
+//Paramters: const ElemType &element - the value being checked for
 //Returns: bool - whether or not the value is stored in the tree
 //Does: Checks if a passed in value is stored within the tree 
-template<typename ElemType>
-bool BST<ElemType>::contains(ElemType element) {
-        return contains_recur(root, element);
+template<typename ElemType, typename Compare, typename StatsPolicy>
+bool BST<ElemType, Compare, StatsPolicy>::contains(const ElemType &element)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        return find_node(element) != nullptr;
 }
 
-//contains Function (private)
-//Parameters: Node *node - the root of the current tree being checked 
-//            ElemType element - the value being checked for 
-//Returns: bool - whether or not the value is stored in the tree 
-//Does: Checks, recursively, if a value is stored in the tree 
-template<typename ElemType> 
-bool BST<ElemType>::contains_recur(Node *node, ElemType element){
-        if (node == nullptr) {
-                return false;
-        }
-        if (node->data == element) {
-                return true;
-        }
-        if (node->data < element) {
-                return contains_recur(node->right, element);
+//contains Function (heterogeneous)
+//Parameters: const Key &key - a value comparable with ElemType
+//Returns: bool - whether or not an equal value is stored in the tree
+//Does: Looks up a key of another type (for example a string_view in a
+//      tree of strings) without constructing an ElemType. Only enabled
+//      when Compare declares is_transparent
+template<typename ElemType, typename Compare, typename StatsPolicy>
+template<typename Key, typename C, typename>
+bool BST<ElemType, Compare, StatsPolicy>::contains(const Key &key)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        return find_node(key) != nullptr;
+}
+
+//find_node Function (private)
+//Parameters: const Key &key - the value being looked for
+//Returns: Node - the node storing an equal value, nullptr if none
+//Does: Walks down from the root making a single three way comparison
+//      at each node
+template<typename ElemType, typename Compare, typename StatsPolicy>
+template<typename Key>
+typename BST<ElemType, Compare, StatsPolicy>::Node *BST<ElemType, Compare, StatsPolicy>::find_node(const Key &key)
+{
+        Node *node = root;
+        while (node != nullptr)
+        {
+                StatsPolicy::node_visit();
+                int cmp = compare_keys(key, node->data);
+                if (cmp == 0)
+                {
+                        return node;
+                }
+                node = (cmp < 0) ? node->left : node->right;
         }
-        return contains_recur(node->left, element);
+        return nullptr;
 }
 
 //remove Function 
@@ -140,10 +227,20 @@ bool BST<ElemType>::contains_recur(Node *node, ElemType element){
 //                        from the tree
 //Returns: bool - whether or not the integer was removed from the 
 //                binary search tree
-//Does: Removes the passed in value from the tree
-template<typename ElemType>
-bool BST<ElemType>::remove(ElemType element) {
-        return remove_recur(root, nullptr, element);
+//Does: Removes the passed in value from the tree. In scapegoat mode the
+//      whole tree is rebuilt once it has shrunk below alpha times the
+//      most nodes it held since the last rebuild
+template<typename ElemType, typename Compare, typename StatsPolicy>
+bool BST<ElemType, Compare, StatsPolicy>::remove(ElemType element) {
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
+        if (!remove_recur(root, nullptr, element)) {
+                return false;
+        }
+        if (alpha != 0 and num_nodes < alpha * max_nodes) {
+                root = rebuild(root, num_nodes);
+                max_nodes = num_nodes;
+        }
+        return true;
 }
 
 //remove_recur Function (private)
@@ -155,20 +252,23 @@ bool BST<ElemType>::remove(ElemType element) {
 //Returns: bool - whether or not the node was removed from the tree 
 //Does: Removes the passed in value from the tree starting at the passed
 //      in node
-template<typename ElemType> 
-bool BST<ElemType>::remove_recur(Node *node, Node *parent, ElemType element) {
+template<typename ElemType, typename Compare, typename StatsPolicy>
+bool BST<ElemType, Compare, StatsPolicy>::remove_recur(Node *node, Node *parent, ElemType element) {
         if (node == nullptr) {
                 return false;
-        } else if (element < node->data) {
+        }
+        StatsPolicy::node_visit();
+        int cmp = compare_keys(element, node->data);
+        if (cmp < 0) {
                 if (node->left != nullptr) {
                         return remove_recur(node->left, node, element);
                 }
-        } else if (element > node->data) {
+        } else if (cmp > 0) {
                 if (node->right != nullptr) {
                         return remove_recur(node->right, node, element);
                 }
         } else {
-                node_found(node, parent, element);
+                node_found(node, parent);
                 return true;
         }
         return false;
@@ -179,17 +279,16 @@ bool BST<ElemType>::remove_recur(Node *node, Node *parent, ElemType element) {
 //            Node *parent - the parent node of the node currently 
 //                           being checked (if it is the root of the 
 //                           entire tree the parent will be nullptr)
-//            int value - the value that is being checked for
 //Returns: Nothing 
 //Does: Checks 3 different cases if the value is found within the tree 
-template<typename ElemType>
-void BST<ElemType>::node_found(Node *node, Node *parent, ElemType element) {
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void BST<ElemType, Compare, StatsPolicy>::node_found(Node *node, Node *parent) {
         if (node->count > 1) {
                 node->count--;
                 return;
         }
         if (node->left == nullptr and node->right == nullptr) {
-                empty_case(node, parent, element);
+                empty_case(node, parent);
         }
         else if (node->left == nullptr and node->right != nullptr) {
                 right_case(node, parent);
@@ -208,24 +307,14 @@ void BST<ElemType>::node_found(Node *node, Node *parent, ElemType element) {
 //            Node *parent - the parent node of the node currently 
 //                           being checked (if it is the root of the 
 //                           entire tree the parent will be nullptr)
-//            int value - the value that is being checked for
 //Returns: Nothing 
 //Does: Checks and deletes node if the current node is considered to 
 //      be a leaf (meaning it has no children)
-template<typename ElemType>
-void BST<ElemType>::empty_case(Node *node, Node *parent, ElemType element) {
-        if (node == root) {
-                delete node;
-                root = nullptr;
-        }
-        else if (parent->left != nullptr and parent->left->data == element) {
-                delete node;
-                parent->left = nullptr;
-        }
-        else {
-                delete node;
-                parent->right = nullptr;
-        }
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void BST<ElemType, Compare, StatsPolicy>::empty_case(Node *node, Node *parent) {
+        replace_child(parent, node, nullptr);
+        delete node;
+        num_nodes--;
 }
 
 
@@ -236,11 +325,11 @@ void BST<ElemType>::empty_case(Node *node, Node *parent, ElemType element) {
 //                           entire tree the parent will be nullptr)
 //Returns: Nothing 
 //Does: Deletes the node if the parent node only has a right child 
-template<typename ElemType>
-void BST<ElemType>::right_case(Node *node, Node *parent) {
-        Node *temp = node->right;
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void BST<ElemType, Compare, StatsPolicy>::right_case(Node *node, Node *parent) {
+        replace_child(parent, node, node->right);
         delete node;
-        parent->left = temp;
+        num_nodes--;
 }
 
 //left_case Function 
@@ -250,31 +339,77 @@ void BST<ElemType>::right_case(Node *node, Node *parent) {
 //                           entire tree the parent will be nullptr)
 //Returns: Nothing 
 //Does: Deletes the node if the parent node only has a left child 
-template<typename ElemType>
-void BST<ElemType>::left_case(Node *node, Node *parent) {
-        Node *temp = node->left;
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void BST<ElemType, Compare, StatsPolicy>::left_case(Node *node, Node *parent) {
+        replace_child(parent, node, node->left);
         delete node;
-        parent->left = temp;
+        num_nodes--;
 }
 
 //update Function 
 //Parameters: Node *node - the root of the current tree being manipulated 
 //Returns: Nothing 
 //Does: Updates the values stored in the current node if the current node 
-//      has 2 children 
-template<typename ElemType>
-void BST<ElemType>::update(Node *node) {
+//      has 2 children. The minimum's count is moved over with its data,
+//      so the node it came from is left with one copy and the following
+//      remove deletes it outright
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void BST<ElemType, Compare, StatsPolicy>::update(Node *node) {
         Node *right_min = find_min_recur(node->right);
         node->data = right_min->data;
         node->count = right_min->count;
+        right_min->count = 1;
+}
+
+//replace_child Function (private)
+//Parameters: Node *parent - parent of node, nullptr if node is the root
+//            Node *node - the child being replaced
+//            Node *child - the subtree taking its place
+//Returns: Nothing
+//Does: Links child into whichever side of parent held node
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void BST<ElemType, Compare, StatsPolicy>::replace_child(Node *parent, Node *node, Node *child) {
+        if (parent == nullptr) {
+                root = child;
+        }
+        else if (parent->left == node) {
+                parent->left = child;
+        }
+        else {
+                parent->right = child;
+        }
+}
+
+//find_min_recur Function (private)
+//Parameters: Node *node - root of a non empty tree
+//Returns: Node - the node with the smallest value
+//Does: Follows left children to the bottom of the tree
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename BST<ElemType, Compare, StatsPolicy>::Node *BST<ElemType, Compare, StatsPolicy>::find_min_recur(Node *node) {
+        if (node->left == nullptr) {
+                return node;
+        }
+        return find_min_recur(node->left);
+}
+
+//find_max_recur Function (private)
+//Parameters: Node *node - root of a non empty tree
+//Returns: Node - the node with the largest value
+//Does: Follows right children to the bottom of the tree
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename BST<ElemType, Compare, StatsPolicy>::Node *BST<ElemType, Compare, StatsPolicy>::find_max_recur(Node *node) {
+        if (node->right == nullptr) {
+                return node;
+        }
+        return find_max_recur(node->right);
 }
 
 //tree_height Function 
 //Parameters: Nothing 
 //Returns: Int - the height of the tree
 //Does: Searches for and returns the height of the BinarySearchTree
-template<typename ElemType>
-int BST<ElemType>::tree_height() {
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int BST<ElemType, Compare, StatsPolicy>::tree_height() {
         return tree_height_recur(root);
 }
 
@@ -282,8 +417,8 @@ int BST<ElemType>::tree_height() {
 //Parameters: Node *node - the root of the tree currently being manipulated
 //Returns: Int - the height of the current tree
 //Does: Checks and returns the height of the current tree
-template<typename ElemType>
-int BST<ElemType>::tree_height_recur(Node *node) {
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int BST<ElemType, Compare, StatsPolicy>::tree_height_recur(Node *node) {
         if (root == nullptr) {
                 return -1;
         }
@@ -306,8 +441,8 @@ int BST<ElemType>::tree_height_recur(Node *node) {
 //Returns: bool - whether or not a node is considered to be a leaf 
 //                (has no children)
 //Does: Returns whether or not a certain node is a leaf or not
-template<typename ElemType>
-bool BST<ElemType>::is_a_leaf(Node *node) {
+template<typename ElemType, typename Compare, typename StatsPolicy>
+bool BST<ElemType, Compare, StatsPolicy>::is_a_leaf(Node *node) {
         if (node == nullptr) {
                 return false;
         }
@@ -321,8 +456,8 @@ bool BST<ElemType>::is_a_leaf(Node *node) {
 //Parameters: Nothing 
 //Returns: Int - total node count
 //Does: Returns the total amount of nodes in a tree
-template<typename ElemType>
-int BST<ElemType>::node_count() {
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int BST<ElemType, Compare, StatsPolicy>::node_count() {
         return node_count_recur(root);
 }
 
@@ -331,8 +466,8 @@ int BST<ElemType>::node_count() {
 //Returns: Int - the number of nodes in the current tree
 //Does: Checks for the number of nodes in the tree starting at the
 //      passed in node 
-template<typename ElemType>
-int BST<ElemType>::node_count_recur(Node *node) {
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int BST<ElemType, Compare, StatsPolicy>::node_count_recur(Node *node) {
         int total_count = 0;
         if (node == nullptr) {
                 return 0;
@@ -346,8 +481,8 @@ int BST<ElemType>::node_count_recur(Node *node) {
 //Parameters: Nothing 
 //Returns: int - total value of all nodes
 //Does: Returns the sum of all the node values (including duplicates)
-template<typename ElemType>
-int BST<ElemType>::count_total() {
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int BST<ElemType, Compare, StatsPolicy>::count_total() {
         return count_total_recur(root);
 }
 
@@ -356,8 +491,8 @@ int BST<ElemType>::count_total() {
 //Returns: Int - sum of all values in current tree
 //Does: Returns the sum of all the node values (including duplicates)
 //      in the tree starting at the passed in node
-template<typename ElemType>
-int BST<ElemType>::count_total_recur(Node *node) {
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int BST<ElemType, Compare, StatsPolicy>::count_total_recur(Node *node) {
         if (node == nullptr) {
                 return 0;
         }
@@ -372,30 +507,149 @@ int BST<ElemType>::count_total_recur(Node *node) {
 //Parameters: ElemType element, element being added to the object
 //Returns: Nothing
 //Does: Inserts an element into the tree 
-template<typename ElemType>
-void BST<ElemType>::insert(ElemType element) {
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void BST<ElemType, Compare, StatsPolicy>::insert(ElemType element) {
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
+        if (alpha != 0) {
+                scapegoat_insert(element);
+                return;
+        }
         root = insert_recur(root, element);
 }
 
+//scapegoat_insert function (private)
+//Parameters: ElemType element, element being added to the BST
+//Returns: Nothing
+//Does: Inserts the element as a leaf, remembering the path down. If the
+//      leaf ends up deeper than alpha_height allows, walks back up
+//      summing subtree sizes until it meets an ancestor whose child on
+//      the path holds more than alpha of its nodes (the scapegoat), and
+//      rebuilds that ancestor's subtree into perfect balance. Rebuilds
+//      cost O(size) but are rare enough that inserts stay amortized
+//      O(log n), and the nodes store no balance information
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void BST<ElemType, Compare, StatsPolicy>::scapegoat_insert(ElemType element) {
+        std::vector<Node *> path;
+        Node *node = root;
+        int cmp = 0;
+        while (node != nullptr) {
+                StatsPolicy::node_visit();
+                cmp = compare_keys(element, node->data);
+                if (cmp == 0) {
+                        node->count++;
+                        return;
+                }
+                path.push_back(node);
+                node = (cmp < 0) ? node->left : node->right;
+        }
+        node = new_node(element);
+        if (path.empty()) {
+                root = node;
+        }
+        else if (cmp < 0) {
+                path.back()->left = node;
+        }
+        else {
+                path.back()->right = node;
+        }
+        if (num_nodes > max_nodes) {
+                max_nodes = num_nodes;
+        }
+        if ((int)path.size() <= alpha_height(num_nodes)) {
+                return;
+        }
+        Node *child = node;
+        int child_size = 1;
+        for (int i = (int)path.size() - 1; i >= 0; i--) {
+                Node *parent = path[i];
+                Node *sibling = (parent->left == child) ? parent->right : parent->left;
+                int parent_size = child_size + 1 + node_count_recur(sibling);
+                if (child_size > alpha * parent_size) {
+                        Node *rebuilt = rebuild(parent, parent_size);
+                        replace_child((i == 0) ? nullptr : path[i-1], parent, rebuilt);
+                        return;
+                }
+                child = parent;
+                child_size = parent_size;
+        }
+}
+
+//alpha_height function (private)
+//Parameters: int n - number of nodes in the tree
+//Returns: int - floor of log base 1/alpha of n
+//Does: Gives the depth past which an insert looks for a scapegoat
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int BST<ElemType, Compare, StatsPolicy>::alpha_height(int n) {
+        return (int)floor(log((double)n) / log(1.0 / alpha));
+}
+
+//rebuild function (private)
+//Parameters: Node *node - root of the subtree being rebuilt
+//            int size - number of nodes in the subtree
+//Returns: Node - the root of the rebuilt subtree
+//Does: Lists the nodes in order and relinks them so every subtree is as
+//      balanced as possible, without allocating or copying any node
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename BST<ElemType, Compare, StatsPolicy>::Node *BST<ElemType, Compare, StatsPolicy>::rebuild(Node *node, int size) {
+        std::vector<Node *> nodes;
+        nodes.reserve(size);
+        flatten(node, nodes);
+        return build_balanced(nodes, 0, (int)nodes.size() - 1);
+}
+
+//flatten function (private)
+//Parameters: Node *node - root of a subtree
+//            std::vector<Node *> &nodes - list the nodes are appended to
+//Returns: Nothing
+//Does: In order traversal that collects the nodes
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void BST<ElemType, Compare, StatsPolicy>::flatten(Node *node, std::vector<Node *> &nodes) {
+        if (node == nullptr) {
+                return;
+        }
+        flatten(node->left, nodes);
+        nodes.push_back(node);
+        flatten(node->right, nodes);
+}
+
+//build_balanced function (private)
+//Parameters: std::vector<Node *> &nodes - nodes in order
+//            int low, int high - the range being linked (inclusive)
+//Returns: Node - root of the range, nullptr if it is empty
+//Does: Makes the middle node the root and builds each half under it
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename BST<ElemType, Compare, StatsPolicy>::Node *BST<ElemType, Compare, StatsPolicy>::build_balanced(std::vector<Node *> &nodes, int low, int high) {
+        if (low > high) {
+                return nullptr;
+        }
+        int mid = low + (high - low) / 2;
+        Node *node = nodes[mid];
+        node->left = build_balanced(nodes, low, mid - 1);
+        node->right = build_balanced(nodes, mid + 1, high);
+        return node;
+}
+
 //insert_recur (private) function
 //Parameters: Node *node, the root of the current tree being inserted
 //                        into
 //            ElemType element, element being added to the BST
 //Returns: Node
 //Does: Recursively inserts the given element into the BST object
-template<typename ElemType>
-typename BST<ElemType>::Node *BST<ElemType>::insert_recur(Node *node, 
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename BST<ElemType, Compare, StatsPolicy>::Node *BST<ElemType, Compare, StatsPolicy>::insert_recur(Node *node, 
                                                         ElemType element)
 {
       	if (node == nullptr) 
         {
                 return new_node(element);
 	} 
-        else if (element < node->data) 
+        StatsPolicy::node_visit();
+        int cmp = compare_keys(element, node->data);
+        if (cmp < 0) 
         {
 		node->left = insert_recur(node->left, element);
 	} 
-        else if (element > node->data)
+        else if (cmp > 0)
         {
 		node->right = insert_recur(node->right, element);
 	}  
@@ -411,8 +665,8 @@ typename BST<ElemType>::Node *BST<ElemType>::insert_recur(Node *node,
 //Returns: Nothing
 //Does: prints all elements within the tree (uncomment the type 
 //      of traversal used)
-template<typename ElemType>
-void BST<ElemType>::print_tree()
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void BST<ElemType, Compare, StatsPolicy>::print_tree()
 {
         //Uncomment the type of traversal wanted:
         // in_order_print(root);
@@ -426,8 +680,8 @@ void BST<ElemType>::print_tree()
 //Returns: Nothing
 //Does: Prints the contents of the tree using
 //      an in-order traversal
-template<typename ElemType>
-void BST<ElemType>::in_order_print(Node *root)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void BST<ElemType, Compare, StatsPolicy>::in_order_print(Node *root)
 {
         if (root == nullptr)
         {
@@ -443,8 +697,8 @@ void BST<ElemType>::in_order_print(Node *root)
 //Returns: Nothing
 //Does: Prints the contents of the tree using
 //      a pre-order traversal
-template<typename ElemType>
-void BST<ElemType>::pre_order_print(Node *root)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void BST<ElemType, Compare, StatsPolicy>::pre_order_print(Node *root)
 {
         stack<Node *> list;
         if (root != nullptr) {
@@ -469,8 +723,8 @@ void BST<ElemType>::pre_order_print(Node *root)
 //Returns: Nothing
 //Does: Prints the contents of the tree using 
 //      a level-order traversal
-template<typename ElemType>
-void BST<ElemType>::level_order_print(Node *root)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void BST<ElemType, Compare, StatsPolicy>::level_order_print(Node *root)
 {
         queue<Node *> list;
         if (root != nullptr) 
@@ -496,13 +750,39 @@ void BST<ElemType>::level_order_print(Node *root)
 //Parameters: ElemType info, value being stored in the node
 //Returns: Node, the node that was dynamically created
 //Does: Creates a node and stores the passed in data
-template<typename ElemType>
-typename BST<ElemType>::Node *BST<ElemType>::new_node(ElemType info)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename BST<ElemType, Compare, StatsPolicy>::Node *BST<ElemType, Compare, StatsPolicy>::new_node(ElemType info)
 {
         Node *temp = new Node;
         temp->data = info;
         temp->count = 1;
         temp->left = nullptr;
         temp->right = nullptr;
+        num_nodes++;
         return temp;
 }
+
+//stats function
+//Parameters: Nothing
+//Returns: StatsSnapshot - copy of the counters kept by the StatsPolicy
+//Does: Reports comparisons, rotations, node visits and per operation
+//      latencies (all zero unless the tree is built with OpStats)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+StatsSnapshot BST<ElemType, Compare, StatsPolicy>::stats()
+{
+        return StatsPolicy::snapshot();
+}
+
+//compare_keys function
+//Parameters: const A &a, const B &b - keys being compared
+//Returns: int - negative if a orders before b, zero if they are equal,
+//         positive if a orders after b
+//Does: Compares two keys with the tree's comparator, counting the
+//      comparison
+template<typename ElemType, typename Compare, typename StatsPolicy>
+template<typename A, typename B>
+int BST<ElemType, Compare, StatsPolicy>::compare_keys(const A &a, const B &b)
+{
+        StatsPolicy::comparison();
+        return compare(a, b);
+}
\ No newline at end of file
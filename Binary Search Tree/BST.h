@@ -12,12 +12,24 @@
 #ifndef BST_H_
 #define BST_H_
 
-template<typename ElemType>
-class BST
+#include "../Comparators/ThreeWayCompare.h"
+#include "../Instrumentation/OpStats.h"
+
+#include <vector>
+
+template<typename ElemType, typename Compare = ThreeWayCompare,
+         typename StatsPolicy = NoStats>
+class BST : private StatsPolicy
 {
         public:
                 //Constructor
                 BST();
+                //Comparator Constructor
+                BST(const Compare &comp);
+                //Scapegoat Constructor
+                BST(double balance_alpha);
+                //Comparator and Scapegoat Constructor
+                BST(const Compare &comp, double balance_alpha);
                 //Destructor
                 ~BST();
                 //Copy Constructor
@@ -25,7 +37,12 @@ class BST
                 //Assignment Operator
                 BST &operator=(const BST &rhs);
                 //checks if an element is stored in the BST 
-                bool contains(ElemType element);
+                bool contains(const ElemType &element);
+                //checks if an element equal to the key is stored, without
+                //converting the key to an ElemType (transparent Compare only)
+                template<typename Key, typename C = Compare,
+                         typename = typename C::is_transparent>
+                bool contains(const Key &key);
                 //inserts an element
                 void insert(ElemType element);
                 //removes an element
@@ -38,6 +55,8 @@ class BST
                 int count_total();
                 //prints values stored in the BST
                 void print_tree();
+                //returns a snapshot of the operation counters
+                StatsSnapshot stats();
 
         private:
         
@@ -51,6 +70,16 @@ class BST
                 };
                 //root of the BST
                 Node *root;
+                //orders the elements
+                Compare compare;
+                //scapegoat balance factor, 0 when the tree is not balanced
+                double alpha;
+                //number of nodes in the tree
+                int num_nodes;
+                //most nodes held since the whole tree was last rebuilt
+                int max_nodes;
+                //sets the balancing mode and empty tree state
+                void init_tree(double balance_alpha);
                 //creates a deep copy of a tree
                 Node *copy_tree(Node *node);
                 //removes all nodes from a tree
@@ -59,20 +88,34 @@ class BST
                 Node *find_min_recur(Node *node);
                 //finds maximum value stored in a tree
                 Node *find_max_recur(Node *node);
-                //checks if an element is stored in a BST
-                bool contains_recur(Node *node, ElemType element);
+                //finds the node storing an element equal to the key
+                template<typename Key>
+                Node *find_node(const Key &key);
                 //removes element from the current subtree
                 bool remove_recur(Node *node, Node *parent, ElemType element);
                 //function called when a node is found when removing an element
-                void node_found(Node *node, Node *parent, ElemType element);
+                void node_found(Node *node, Node *parent);
                 //function called when element is a leaf node
-                void empty_case(Node *node, Node *parent, ElemType element);
+                void empty_case(Node *node, Node *parent);
                 //function called when left node is empty
                 void right_case(Node *node, Node *parent);
                 //function called when right node is empty
                 void left_case(Node *node, Node *parent);
                 //updates values stored in node
                 void update(Node *node);
+                //points parent (or root) at child instead of node
+                void replace_child(Node *parent, Node *node, Node *child);
+                //inserts an element, rebuilding the subtree of a scapegoat
+                //if the new node is too deep
+                void scapegoat_insert(ElemType element);
+                //deepest a node may be in a tree of n nodes before a rebuild
+                int alpha_height(int n);
+                //rebuilds a subtree into perfect balance
+                Node *rebuild(Node *node, int size);
+                //appends the nodes of a subtree in order
+                void flatten(Node *node, std::vector<Node *> &nodes);
+                //links nodes[low..high] into a perfectly balanced tree
+                Node *build_balanced(std::vector<Node *> &nodes, int low, int high);
                 //finds the height of a tree starting at the passed in node
                 int tree_height_recur(Node *node);
                 //determines if a node is a leaf 
@@ -92,6 +135,9 @@ class BST
                 void level_order_print(Node *root);
                 //creates and allocates memory for a new node
                 Node *new_node(ElemType info);
+                //three way comparison of two keys, counting the comparison
+                template<typename A, typename B>
+                int compare_keys(const A &a, const B &b);
 };
 
 #endif 
\ No newline at end of file
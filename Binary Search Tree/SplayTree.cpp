@@ -0,0 +1,492 @@
+/*
+ *
+ * Splay Tree Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * SplayTree.cpp
+ * Full function declaration
+ *
+ */
+
+#include "SplayTree.h"
+#include <iostream>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+//default constructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Initializes an instance of the Class
+template<typename ElemType, typename Compare, typename StatsPolicy>
+SplayTree<ElemType, Compare, StatsPolicy>::SplayTree()
+{
+        root = nullptr;
+}
+
+//comparator constructor
+//Parameters: const Compare &comp - the comparator used to order elements
+//Returns: Nothing
+//Does: Initializes an empty instance of the Class that orders its
+//      elements with the passed in comparator
+template<typename ElemType, typename Compare, typename StatsPolicy>
+SplayTree<ElemType, Compare, StatsPolicy>::SplayTree(const Compare &comp)
+{
+        root = nullptr;
+        compare = comp;
+}
+
+//destructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Deletes all dynamically allocated memory
+template<typename ElemType, typename Compare, typename StatsPolicy>
+SplayTree<ElemType, Compare, StatsPolicy>::~SplayTree()
+{
+        delete_tree(root);
+}
+
+//copy constructor
+//Parameters: const SplayTree &rhs, the tree being copied
+//Returns: Nothing
+//Does: Makes a deep copy of rhs with the same shape
+template<typename ElemType, typename Compare, typename StatsPolicy>
+SplayTree<ElemType, Compare, StatsPolicy>::SplayTree(const SplayTree &rhs)
+{
+        compare = rhs.compare;
+        root = copy_tree(rhs.root);
+}
+
+//assignment operator
+//Parameters: const SplayTree &rhs, the tree that is being copied
+//            into the current instance
+//Returns: SplayTree, the object that copied all data from rhs
+//Does: Frees the current tree and copies rhs into it
+template<typename ElemType, typename Compare, typename StatsPolicy>
+SplayTree<ElemType, Compare, StatsPolicy> &SplayTree<ElemType, Compare, StatsPolicy>::operator=(const SplayTree &rhs)
+{
+        if (this != &rhs)
+        {
+                delete_tree(root);
+                compare = rhs.compare;
+                root = copy_tree(rhs.root);
+        }
+        return *this;
+}
+
+//copy_tree function (private)
+//Parameters: Node *node, the current node being copied
+//Returns: Node, the root of the copy
+//Does: Makes a deep copy of the tree beginning at the passed in node.
+//      Uses an explicit stack of (node, link to fill) pairs, since a
+//      splay tree can be a single n deep spine
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename SplayTree<ElemType, Compare, StatsPolicy>::Node *SplayTree<ElemType, Compare, StatsPolicy>::copy_tree(Node *node)
+{
+        Node *copy = nullptr;
+        vector<pair<Node *, Node **> > pending;
+        pending.push_back(make_pair(node, &copy));
+        while (!pending.empty())
+        {
+                Node *from = pending.back().first;
+                Node **link = pending.back().second;
+                pending.pop_back();
+                if (from == nullptr)
+                {
+                        *link = nullptr;
+                        continue;
+                }
+                Node *temp_node = new Node();
+                temp_node->data = from->data;
+                temp_node->count = from->count;
+                *link = temp_node;
+                pending.push_back(make_pair(from->right, &temp_node->right));
+                pending.push_back(make_pair(from->left, &temp_node->left));
+        }
+        return copy;
+}
+
+//delete_tree function (private)
+//Parameters: Node *node, the starting node of the tree being deleted
+//Returns: Nothing
+//Does: Deletes all nodes stored in the tree without recursion or extra
+//      memory. A node with a left child is rotated right, so the tree
+//      turns into a right leaning vine that is deleted front to back
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void SplayTree<ElemType, Compare, StatsPolicy>::delete_tree(Node *node)
+{
+        while (node != nullptr)
+        {
+                if (node->left != nullptr)
+                {
+                        Node *child = node->left;
+                        node->left = child->right;
+                        child->right = node;
+                        node = child;
+                }
+                else
+                {
+                        Node *next = node->right;
+                        delete node;
+                        node = next;
+                }
+        }
+}
+
+//contains Function
+//Paramters: const ElemType &element - the value being checked for
+//Returns: bool - whether or not the value is stored in the tree
+//Does: Splays the value (or the last node on its search path) to the
+//      root, so a repeated lookup of a hot key costs one comparison
+template<typename ElemType, typename Compare, typename StatsPolicy>
+bool SplayTree<ElemType, Compare, StatsPolicy>::contains(const ElemType &element)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        root = splay(root, element);
+        return root != nullptr and compare_keys(element, root->data) == 0;
+}
+
+//contains Function (heterogeneous)
+//Parameters: const Key &key - a value comparable with ElemType
+//Returns: bool - whether or not an equal value is stored in the tree
+//Does: Splaying lookup of a key of another type, without constructing
+//      an ElemType. Only enabled when Compare declares is_transparent
+template<typename ElemType, typename Compare, typename StatsPolicy>
+template<typename Key, typename C, typename>
+bool SplayTree<ElemType, Compare, StatsPolicy>::contains(const Key &key)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        root = splay(root, key);
+        return root != nullptr and compare_keys(key, root->data) == 0;
+}
+
+//peek Function
+//Paramters: const ElemType &element - the value being checked for
+//Returns: bool - whether or not the value is stored in the tree
+//Does: Plain binary search that leaves the tree as it is. It skips the
+//      stats hooks, which write shared counters, so several readers may
+//      peek at once, but not while any other operation runs
+template<typename ElemType, typename Compare, typename StatsPolicy>
+bool SplayTree<ElemType, Compare, StatsPolicy>::peek(const ElemType &element) const
+{
+        Node *node = root;
+        while (node != nullptr)
+        {
+                int cmp = compare(element, node->data);
+                if (cmp == 0)
+                {
+                        return true;
+                }
+                node = (cmp < 0) ? node->left : node->right;
+        }
+        return false;
+}
+
+//peek Function (heterogeneous)
+//Parameters: const Key &key - a value comparable with ElemType
+//Returns: bool - whether or not an equal value is stored in the tree
+//Does: Same as peek, for a key of another type, without constructing
+//      an ElemType. Only enabled when Compare declares is_transparent
+template<typename ElemType, typename Compare, typename StatsPolicy>
+template<typename Key, typename C, typename>
+bool SplayTree<ElemType, Compare, StatsPolicy>::peek(const Key &key) const
+{
+        Node *node = root;
+        while (node != nullptr)
+        {
+                int cmp = compare(key, node->data);
+                if (cmp == 0)
+                {
+                        return true;
+                }
+                node = (cmp < 0) ? node->left : node->right;
+        }
+        return false;
+}
+
+//insert function
+//Parameters: ElemType element, element being added to the tree
+//Returns: Nothing
+//Does: Splays the element's position to the root, then either counts a
+//      duplicate or makes a new root with the old tree split under it
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void SplayTree<ElemType, Compare, StatsPolicy>::insert(ElemType element)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
+        root = splay(root, element);
+        int cmp = (root == nullptr) ? 0 : compare_keys(element, root->data);
+        if (root != nullptr and cmp == 0)
+        {
+                root->count++;
+                return;
+        }
+        Node *node = new_node(element);
+        if (root != nullptr and cmp < 0)
+        {
+                node->left = root->left;
+                node->right = root;
+                root->left = nullptr;
+        }
+        else if (root != nullptr)
+        {
+                node->right = root->right;
+                node->left = root;
+                root->right = nullptr;
+        }
+        root = node;
+}
+
+//remove Function
+//Parameters: ElemType element - the value being removed from the tree
+//Returns: bool - whether or not the value was in the tree
+//Does: Splays the element to the root and removes one copy of it. When
+//      the node goes, the largest element of its left subtree is splayed
+//      up and takes the right subtree as its right child
+template<typename ElemType, typename Compare, typename StatsPolicy>
+bool SplayTree<ElemType, Compare, StatsPolicy>::remove(ElemType element)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
+        root = splay(root, element);
+        if (root == nullptr or compare_keys(element, root->data) != 0)
+        {
+                return false;
+        }
+        if (root->count > 1)
+        {
+                root->count--;
+                return true;
+        }
+        Node *old_root = root;
+        if (root->left == nullptr)
+        {
+                root = root->right;
+        }
+        else
+        {
+                root = splay(root->left, element);
+                root->right = old_root->right;
+        }
+        delete old_root;
+        return true;
+}
+
+//splay function (private)
+//Parameters: Node *node - root of the tree being splayed
+//            const Key &key - the value being searched for
+//Returns: Node - the new root, which holds key if it is in the tree and
+//         otherwise the last node on its search path
+//Does: Top-down splay. Walking down, nodes smaller than the key are
+//      hung off a left tree and larger ones off a right tree, rotating
+//      whenever the path goes the same way twice (zig-zig) so the depth
+//      of every node on the path roughly halves. At the bottom the two
+//      trees become the children of the node reached
+template<typename ElemType, typename Compare, typename StatsPolicy>
+template<typename Key>
+typename SplayTree<ElemType, Compare, StatsPolicy>::Node *SplayTree<ElemType, Compare, StatsPolicy>::splay(Node *node, const Key &key)
+{
+        if (node == nullptr)
+        {
+                return nullptr;
+        }
+        //header.right is the root of the left tree and header.left the
+        //root of the right tree
+        Node header;
+        header.left = header.right = nullptr;
+        Node *left_max = &header;
+        Node *right_min = &header;
+        while (true)
+        {
+                StatsPolicy::node_visit();
+                int cmp = compare_keys(key, node->data);
+                if (cmp < 0)
+                {
+                        if (node->left == nullptr)
+                        {
+                                break;
+                        }
+                        if (compare_keys(key, node->left->data) < 0)
+                        {
+                                StatsPolicy::rotation();
+                                Node *child = node->left;
+                                node->left = child->right;
+                                child->right = node;
+                                node = child;
+                                if (node->left == nullptr)
+                                {
+                                        break;
+                                }
+                        }
+                        right_min->left = node;
+                        right_min = node;
+                        node = node->left;
+                }
+                else if (cmp > 0)
+                {
+                        if (node->right == nullptr)
+                        {
+                                break;
+                        }
+                        if (compare_keys(key, node->right->data) > 0)
+                        {
+                                StatsPolicy::rotation();
+                                Node *child = node->right;
+                                node->right = child->left;
+                                child->left = node;
+                                node = child;
+                                if (node->right == nullptr)
+                                {
+                                        break;
+                                }
+                        }
+                        left_max->right = node;
+                        left_max = node;
+                        node = node->right;
+                }
+                else
+                {
+                        break;
+                }
+        }
+        left_max->right = node->left;
+        right_min->left = node->right;
+        node->left = header.right;
+        node->right = header.left;
+        return node;
+}
+
+//tree_height Function
+//Parameters: Nothing
+//Returns: Int - the height of the tree, -1 if it is empty
+//Does: Searches for and returns the height of the tree
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int SplayTree<ElemType, Compare, StatsPolicy>::tree_height()
+{
+        int levels, nodes;
+        level_walk(levels, nodes);
+        return levels - 1;
+}
+
+//node_count Function
+//Parameters: Nothing
+//Returns: Int - total node count
+//Does: Returns the total amount of nodes in a tree
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int SplayTree<ElemType, Compare, StatsPolicy>::node_count()
+{
+        int levels, nodes;
+        level_walk(levels, nodes);
+        return nodes;
+}
+
+//level_walk Function (private)
+//Parameters: int &levels - set to the number of levels in the tree
+//            int &nodes - set to the number of nodes in the tree
+//Returns: Nothing
+//Does: Level order walk that holds one level at a time, so a deep spine
+//      costs no stack depth
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void SplayTree<ElemType, Compare, StatsPolicy>::level_walk(int &levels, int &nodes)
+{
+        levels = nodes = 0;
+        vector<Node *> level;
+        vector<Node *> next_level;
+        if (root != nullptr)
+        {
+                level.push_back(root);
+        }
+        while (!level.empty())
+        {
+                levels++;
+                nodes += level.size();
+                next_level.clear();
+                for (size_t i = 0; i < level.size(); i++)
+                {
+                        if (level[i]->left != nullptr)
+                        {
+                                next_level.push_back(level[i]->left);
+                        }
+                        if (level[i]->right != nullptr)
+                        {
+                                next_level.push_back(level[i]->right);
+                        }
+                }
+                level.swap(next_level);
+        }
+}
+
+//print_tree function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: prints all elements within the tree in order
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void SplayTree<ElemType, Compare, StatsPolicy>::print_tree()
+{
+        in_order_print(root);
+        cout << endl;
+}
+
+//in_order_print function (private)
+//Parameters: Node *node, the root of the tree
+//Returns: Nothing
+//Does: Prints the contents of the tree using an in-order traversal,
+//      keeping the path of nodes still to be printed on an explicit
+//      stack
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void SplayTree<ElemType, Compare, StatsPolicy>::in_order_print(Node *node)
+{
+        vector<Node *> path;
+        while (node != nullptr or !path.empty())
+        {
+                while (node != nullptr)
+                {
+                        path.push_back(node);
+                        node = node->left;
+                }
+                node = path.back();
+                path.pop_back();
+                cout << node->data << " ";
+                node = node->right;
+        }
+}
+
+//new_node function (private)
+//Parameters: ElemType info, value being stored in the node
+//Returns: Node, the node that was dynamically created
+//Does: Creates a node and stores the passed in data
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename SplayTree<ElemType, Compare, StatsPolicy>::Node *SplayTree<ElemType, Compare, StatsPolicy>::new_node(ElemType info)
+{
+        Node *temp = new Node;
+        temp->data = info;
+        temp->count = 1;
+        temp->left = nullptr;
+        temp->right = nullptr;
+        return temp;
+}
+
+//stats function
+//Parameters: Nothing
+//Returns: StatsSnapshot - copy of the counters kept by the StatsPolicy
+//Does: Reports comparisons, rotations, node visits and per operation
+//      latencies (all zero unless the tree is built with OpStats)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+StatsSnapshot SplayTree<ElemType, Compare, StatsPolicy>::stats()
+{
+        return StatsPolicy::snapshot();
+}
+
+//compare_keys function (private)
+//Parameters: const A &a, const B &b - keys being compared
+//Returns: int - negative if a orders before b, zero if they are equal,
+//         positive if a orders after b
+//Does: Compares two keys with the tree's comparator, counting the
+//      comparison
+template<typename ElemType, typename Compare, typename StatsPolicy>
+template<typename A, typename B>
+int SplayTree<ElemType, Compare, StatsPolicy>::compare_keys(const A &a, const B &b)
+{
+        StatsPolicy::comparison();
+        return compare(a, b);
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+/*
+ *
+ * Splay Tree Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * SplayTree.h
+ * Class Header and Declaration
+ *
+ * Self adjusting binary search tree. contains, insert and remove splay
+ * the node they reach to the root (top-down, in a single pass with no
+ * parent pointers or recursion), so recently used keys stay near the top
+ * and a skewed workload where a few hot keys dominate only touches a few
+ * nodes per access. Operations are amortized O(log n). peek looks a key
+ * up without restructuring the tree or touching the stats counters, so
+ * readers can share the tree as long as no other operation runs at the
+ * same time. Sequential
+ * inserts leave a spine n nodes deep, so copying, deleting, printing and
+ * measuring the tree are iterative as well.
+ *
+ */
+
+#ifndef SPLAYTREE_H_
+#define SPLAYTREE_H_
+
+#include "../Comparators/ThreeWayCompare.h"
+#include "../Instrumentation/OpStats.h"
+
+template<typename ElemType, typename Compare = ThreeWayCompare,
+         typename StatsPolicy = NoStats>
+class SplayTree : private StatsPolicy
+{
+        public:
+                //Constructor
+                SplayTree();
+                //Comparator Constructor
+                SplayTree(const Compare &comp);
+                //Destructor
+                ~SplayTree();
+                //Copy Constructor
+                SplayTree(const SplayTree &rhs);
+                //Assignment Operator
+                SplayTree &operator=(const SplayTree &rhs);
+                //checks if an element is stored, splaying it to the root
+                bool contains(const ElemType &element);
+                //checks if an element equal to the key is stored, without
+                //converting the key to an ElemType (transparent Compare only)
+                template<typename Key, typename C = Compare,
+                         typename = typename C::is_transparent>
+                bool contains(const Key &key);
+                //checks if an element is stored without changing the tree
+                bool peek(const ElemType &element) const;
+                //checks if an element equal to the key is stored without
+                //changing the tree (transparent Compare only)
+                template<typename Key, typename C = Compare,
+                         typename = typename C::is_transparent>
+                bool peek(const Key &key) const;
+                //inserts an element
+                void insert(ElemType element);
+                //removes an element
+                bool remove(ElemType element);
+                //Checks the height of the tree
+                int tree_height();
+                //Counts number of nodes
+                int node_count();
+                //prints values stored in the tree
+                void print_tree();
+                //returns a snapshot of the operation counters
+                StatsSnapshot stats();
+
+        private:
+
+                //struct to store node information
+                struct Node
+                {
+                        ElemType data;
+                        int count;
+                        Node *left;
+                        Node *right;
+                };
+                //root of the tree
+                Node *root;
+                //orders the elements
+                Compare compare;
+                //creates a deep copy of a tree
+                Node *copy_tree(Node *node);
+                //removes all nodes from a tree
+                void delete_tree(Node *node);
+                //brings the node nearest the key to the root of a tree
+                template<typename Key>
+                Node *splay(Node *node, const Key &key);
+                //counts the levels and nodes of the tree
+                void level_walk(int &levels, int &nodes);
+                //in order traversal print
+                void in_order_print(Node *node);
+                //creates and allocates memory for a new node
+                Node *new_node(ElemType info);
+                //three way comparison of two keys, counting the comparison
+                template<typename A, typename B>
+                int compare_keys(const A &a, const B &b);
+};
+
+#endif
\ No newline at end of file
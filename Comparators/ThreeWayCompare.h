@@ -0,0 +1,72 @@
+/*
+ *
+ * Three Way Comparator
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * ThreeWayCompare.h
+ * Class Header and Declaration
+ *
+ * The trees call their Compare type once per node visited and branch on
+ * the sign of the result (negative: a before b, zero: equal, positive:
+ * a after b). ThreeWayCompare is transparent, so it accepts any pair of
+ * types that can be ordered against each other and the trees expose
+ * heterogeneous lookups (e.g. probing a tree of std::string with a
+ * const char * or std::string_view without building a std::string).
+ *
+ */
+
+#ifndef THREEWAYCOMPARE_H_
+#define THREEWAYCOMPARE_H_
+
+#include <string>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+struct ThreeWayCompare
+{
+        //marks the comparator as accepting mixed argument types
+        typedef void is_transparent;
+
+        //generic comparison built from operator<
+        template<typename A, typename B>
+        int operator()(const A &a, const B &b) const
+        {
+                if (a < b)
+                {
+                        return -1;
+                }
+                if (b < a)
+                {
+                        return 1;
+                }
+                return 0;
+        }
+
+        //strings compare in a single pass instead of two
+        int operator()(const std::string &a, const std::string &b) const
+        {
+                return a.compare(b);
+        }
+        int operator()(const std::string &a, const char *b) const
+        {
+                return a.compare(b);
+        }
+        int operator()(const char *a, const std::string &b) const
+        {
+                return -b.compare(a);
+        }
+#if __cplusplus >= 201703L
+        int operator()(const std::string &a, std::string_view b) const
+        {
+                return std::string_view(a).compare(b);
+        }
+        int operator()(std::string_view a, const std::string &b) const
+        {
+                return a.compare(std::string_view(b));
+        }
+#endif
+};
+
+#endif
\ No newline at end of file
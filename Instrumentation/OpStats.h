@@ -0,0 +1,131 @@
+/*
+ *
+ * Container Instrumentation Policies
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * OpStats.h
+ * Class Header and Declaration
+ *
+ * Containers take a StatsPolicy template parameter and privately inherit
+ * from it. NoStats is an empty class whose hooks are empty inline
+ * functions, so the default build keeps the same object size and code as
+ * before. OpStats counts comparisons, rotations, reallocations and node
+ * visits, and keeps a log2 latency histogram per operation kind, all of
+ * which is read back through the container's stats() snapshot.
+ *
+ */
+
+#ifndef OPSTATS_H_
+#define OPSTATS_H_
+
+#include <chrono>
+
+//the kinds of operation timed by the instrumentation
+enum StatOps {STAT_INSERT, STAT_REMOVE, STAT_LOOKUP, STAT_OPS};
+
+//number of latency buckets, bucket i holds operations that took
+//[2^(i-1), 2^i) nanoseconds (bucket 0 holds 0ns)
+const int LATENCY_BUCKETS = 32;
+
+//point in time copy of the counters kept by a container
+struct StatsSnapshot
+{
+        long long comparisons;
+        long long rotations;
+        long long reallocations;
+        long long node_visits;
+        long long op_count[STAT_OPS];
+        long long latency_histogram[STAT_OPS][LATENCY_BUCKETS];
+
+        //Constructor, zeroes every counter
+        StatsSnapshot()
+        {
+                comparisons = rotations = reallocations = node_visits = 0;
+                for (int op = 0; op < STAT_OPS; op++)
+                {
+                        op_count[op] = 0;
+                        for (int b = 0; b < LATENCY_BUCKETS; b++)
+                        {
+                                latency_histogram[op][b] = 0;
+                        }
+                }
+        }
+};
+
+//disabled policy, every hook compiles away
+class NoStats
+{
+        public:
+                //times one operation for the lifetime of the object
+                class Timer
+                {
+                        public:
+                                Timer(NoStats &, StatOps) {}
+                };
+
+                void comparison() {}
+                void rotation() {}
+                void reallocation() {}
+                void node_visit() {}
+                //always returns an all zero snapshot
+                StatsSnapshot snapshot() const { return StatsSnapshot(); }
+                void reset_stats() {}
+};
+
+//enabled policy, counts events and per operation latencies
+class OpStats
+{
+        public:
+                //times one operation for the lifetime of the object
+                class Timer
+                {
+                        public:
+                                Timer(OpStats &owner, StatOps op)
+                                        : stats(owner), kind(op),
+                                          start(std::chrono::steady_clock::now())
+                                {
+                                }
+                                ~Timer()
+                                {
+                                        std::chrono::steady_clock::duration d =
+                                                std::chrono::steady_clock::now() - start;
+                                        stats.record(kind, std::chrono::duration_cast<
+                                                std::chrono::nanoseconds>(d).count());
+                                }
+
+                        private:
+                                OpStats &stats;
+                                StatOps kind;
+                                std::chrono::steady_clock::time_point start;
+                };
+
+                void comparison() { counters.comparisons++; }
+                void rotation() { counters.rotations++; }
+                void reallocation() { counters.reallocations++; }
+                void node_visit() { counters.node_visits++; }
+                //returns a copy of the current counters
+                StatsSnapshot snapshot() const { return counters; }
+                //zeroes every counter
+                void reset_stats() { counters = StatsSnapshot(); }
+
+        private:
+
+                //counters accumulated so far
+                StatsSnapshot counters;
+
+                //adds one timed operation to its latency histogram
+                void record(StatOps op, long long nanos)
+                {
+                        int bucket = 0;
+                        while (nanos > 0 and bucket < LATENCY_BUCKETS - 1)
+                        {
+                                nanos >>= 1;
+                                bucket++;
+                        }
+                        counters.op_count[op]++;
+                        counters.latency_histogram[op][bucket]++;
+                }
+};
+
+#endif
\ No newline at end of file
@@ -12,6 +12,7 @@
 #include "LinkedList.h"
 
 #include <iostream>
+#include <cstdlib>
 
 using namespace std;
 
@@ -23,7 +24,9 @@ template<typename ElemType>
 LinkedList<ElemType>::LinkedList()
 {
         front = nullptr;
+        back = nullptr;
         length = 0;
+        forget_cursor();
 }
 
 //element constructor
@@ -37,7 +40,9 @@ LinkedList<ElemType>::LinkedList(ElemType element)
 {
         Node *temp = new Node(element, nullptr, nullptr);
         front = temp;
+        back = temp;
         length = 1;
+        forget_cursor();
 }
 
 //array constructor
@@ -50,9 +55,11 @@ template<typename ElemType>
 LinkedList<ElemType>::LinkedList(ElemType *array, int size)
 {
         length = 0;
+        forget_cursor();
         if (size == 0)
         {
                 front = nullptr;
+                back = nullptr;
                 return;
         }
         Node *first = new Node(array[0], nullptr, nullptr);
@@ -63,6 +70,7 @@ LinkedList<ElemType>::LinkedList(ElemType *array, int size)
                 first->next = next_one;
                 first = first->next;
         }
+        back = first;
         length = size;
 }
 
@@ -77,6 +85,23 @@ LinkedList<ElemType>::LinkedList(const LinkedList &rhs)
         copy_linked_list(rhs);
 }
 
+//move constructor
+//Parameters: LinkedList &&rhs, instance whose nodes are taken
+//Returns: Nothing
+//Does: Takes over the nodes of rhs without copying them, leaving
+//      rhs empty
+template<typename ElemType>
+LinkedList<ElemType>::LinkedList(LinkedList &&rhs)
+{
+        front = rhs.front;
+        back = rhs.back;
+        length = rhs.length;
+        rhs.front = rhs.back = nullptr;
+        rhs.length = 0;
+        forget_cursor();
+        rhs.forget_cursor();
+}
+
 //destructor
 //Parameters: Nothing
 //Returns: Nothing
@@ -117,6 +142,28 @@ LinkedList<ElemType> &LinkedList<ElemType>::operator=(const LinkedList &rhs)
         return *this;
 }
 
+//move assignment operator
+//Parameters: LinkedList &&rhs, instance whose nodes are taken
+//Returns: LinkedList<ElemType>
+//Does: Frees the current nodes and takes over the nodes of rhs,
+//      leaving rhs empty
+template<typename ElemType>
+LinkedList<ElemType> &LinkedList<ElemType>::operator=(LinkedList &&rhs)
+{
+        if (this == &rhs)
+        {
+                return *this;
+        }
+        clear();
+        front = rhs.front;
+        back = rhs.back;
+        length = rhs.length;
+        rhs.front = rhs.back = nullptr;
+        rhs.length = 0;
+        rhs.forget_cursor();
+        return *this;
+}
+
 //is_empty function
 //Parameters: Nothing
 //Returns: bool
@@ -146,7 +193,9 @@ void LinkedList<ElemType>::clear()
                 delete temp;
         }
         front = nullptr;
+        back = nullptr;
         length = 0;
+        forget_cursor();
 }
 
 //size function
@@ -187,38 +236,19 @@ ElemType LinkedList<ElemType>::last()
                 throw runtime_error("cannot get last "
                                         "of empty doubly-linked list");
         }
-        ElemType info;
-        Node *curr = front;
-        while (curr != nullptr)
-        {
-                if (curr->next == nullptr)
-                {
-                        info = curr->data;
-                }
-                curr = curr->next;
-        }
-        return info;
+        return back->data;
 }
 
 //element_at function
 //Parameters: int index, index being accessed
 //Returns: ElemType
-//Does: Returns the element stored at the given index
+//Does: Returns the element stored at the given index. The node found
+//      is cached, so reading indices in order costs O(1) each
 template<typename ElemType>
 ElemType LinkedList<ElemType>::element_at(int index)
 {
         ensure_in_range(index, 0, length-1);
-        Node *curr = front;
-        ElemType info;
-        for (int i = 0; i <= index; i++)
-        {   
-                if (i == index)
-                {
-                        info = curr->data;
-                }
-                curr = curr->next;
-        }
-    return info;
+        return node_at(index)->data;
 }
 
 //print function
@@ -251,21 +281,7 @@ void LinkedList<ElemType>::print()
 template<typename ElemType>
 void LinkedList<ElemType>::push_at_back(ElemType element)
 {
-        Node *curr = front;
-        while (curr != nullptr)
-        {
-                if (curr->next == nullptr)
-                {
-                Node *a_new = new Node(element, nullptr, curr);
-                curr->next = a_new;
-                length++;
-                return;
-                }
-                curr = curr->next;
-        }
-        Node *a_new = new Node(element, nullptr, nullptr);
-        front = a_new;
-        length++;
+        link_after(back, element);
 }
 
 //push_at_front function
@@ -281,10 +297,12 @@ void LinkedList<ElemType>::push_at_front(ElemType element)
                 front->prev = elem_new;
                 front = elem_new;
                 length++;
+                cursor_index++;
                 return;
         }
         Node *a_new = new Node(element, nullptr, nullptr);
         front = a_new;
+        back = a_new;
         length++;
 }
 
@@ -315,28 +333,115 @@ void LinkedList<ElemType>::insert_at(ElemType element, int index)
 //insert_in_order function
 //Parameters: ElemType element, item added to the LinkedList
 //Returns: Nothing
-//Does: Inserts the element by value in ascending order
+//Does: Inserts the element by value in ascending order, after any
+//      equal elements. The node is linked in where the scan stops
+//      instead of walking the list a second time through insert_at
 template<typename ElemType>
 void LinkedList<ElemType>::insert_in_order(ElemType element)
 {
-        int index = 0;
+        forget_cursor();
+        Node *prev = nullptr;
         Node *curr = front;
-        if (front == nullptr)
+        while (curr != nullptr and !(element < curr->data))
         {
-                push_at_front(element);
-                return;
+                prev = curr;
+                curr = curr->next;
         }
-        while (!(element < curr->data))
+        link_after(prev, element);
+}
+
+//insert_sorted_range function
+//Parameters: ElemType *array, elements in ascending order
+//            int size, length of the array
+//Returns: Nothing
+//Does: Merges the array into the (sorted) LinkedList in a single pass.
+//      The scan for each element starts where the previous one was
+//      linked in, so the whole batch costs O(length + size)
+template<typename ElemType>
+void LinkedList<ElemType>::insert_sorted_range(ElemType *array, int size)
+{
+        forget_cursor();
+        Node *prev = nullptr;
+        Node *curr = front;
+        for (int i = 0; i < size; i++)
         {
-                if (curr->next == nullptr)
+                while (curr != nullptr and !(array[i] < curr->data))
                 {
-                        push_at_back(element);
+                        prev = curr;
+                        curr = curr->next;
+                }
+                prev = link_after(prev, array[i]);
+        }
+}
+
+//sort function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Stable bottom-up merge sort that relinks the existing nodes.
+//      Each pass merges neighbouring sorted runs of width elements,
+//      doubling width until one run is left: O(n log n) comparisons
+//      with no extra memory and no copies of the data
+template<typename ElemType>
+void LinkedList<ElemType>::sort()
+{
+        if (length < 2)
+        {
                 return;
+        }
+        forget_cursor();
+        for (int width = 1; ; width *= 2)
+        {
+                Node *left = front;
+                Node *tail = nullptr;
+                int merges = 0;
+                front = nullptr;
+                while (left != nullptr)
+                {
+                        merges++;
+                        Node *right = left;
+                        int left_size = 0;
+                        while (left_size < width and right != nullptr)
+                        {
+                                left_size++;
+                                right = right->next;
+                        }
+                        int right_size = width;
+                        while (left_size > 0 or (right_size > 0 and right != nullptr))
+                        {
+                                Node *next_one;
+                                if (left_size == 0 or (right_size > 0 and right != nullptr
+                                                       and right->data < left->data))
+                                {
+                                        next_one = right;
+                                        right = right->next;
+                                        right_size--;
+                                }
+                                else
+                                {
+                                        next_one = left;
+                                        left = left->next;
+                                        left_size--;
+                                }
+                                if (tail == nullptr)
+                                {
+                                        front = next_one;
+                                }
+                                else
+                                {
+                                        tail->next = next_one;
+                                }
+                                next_one->prev = tail;
+                                tail = next_one;
+                        }
+                        left = right;
+                }
+                tail->next = nullptr;
+                back = tail;
+                if (merges <= 1)
+                {
+                        return;
                 }
-                curr = curr->next;
-                index++;
         }
-        insert_at(element, index);
 }
 
 //pop_from_front function
@@ -354,6 +459,22 @@ void LinkedList<ElemType>::pop_from_front()
         Node *temp = front;
         Node *next = front->next;
         front = next;
+        if (cursor == temp)
+        {
+                forget_cursor();
+        }
+        else
+        {
+                cursor_index--;
+        }
+        if (front == nullptr)
+        {
+                back = nullptr;
+        }
+        else
+        {
+                front->prev = nullptr;
+        }
         delete temp;
         length--;
 }
@@ -373,20 +494,17 @@ void LinkedList<ElemType>::pop_from_back()
         else if (length == 1)
         {
                 pop_from_front();
+                return;
         }
-        Node *curr = front;
-        while (curr != nullptr)
+        Node *last_one = back->prev;
+        if (cursor == back)
         {
-                if (curr->next == nullptr)
-                {
-                        Node *last_one = curr->prev;
-                        delete curr;
-                        last_one->next = nullptr;
-                        length--;
-                        return;
-                }
-                curr = curr->next;
+                forget_cursor();
         }
+        delete back;
+        last_one->next = nullptr;
+        back = last_one;
+        length--;
 }
 
 //remove_at function
@@ -401,7 +519,7 @@ void LinkedList<ElemType>::remove_at(int index)
         {
                 pop_from_front();
         }
-        else if (index == length)
+        else if (index == length-1)
         {
                 pop_from_back();
         }
@@ -421,16 +539,119 @@ template<typename ElemType>
 void LinkedList<ElemType>::replace_at(ElemType element, int index)
 {
         ensure_in_range(index, 0, length-1);
-        Node *curr = front;
-        for (int i = 0; i <= index; i++)
+        node_at(index)->data = element;
+}
+
+//splice function
+//Parameters: int pos, index in this LinkedList the elements go in front of
+//            LinkedList &other, a different LinkedList
+//            int first, index of the first element moved out of other
+//            int last, index one past the last element moved
+//Returns: Nothing
+//Does: Unlinks elements first to last-1 from other and links the same
+//      nodes in at pos, no nodes are allocated or copied. Finding the
+//      nodes walks from the nearer end of each list, so moving a whole
+//      list or a range at either end costs O(1)
+template<typename ElemType>
+void LinkedList<ElemType>::splice(int pos, LinkedList &other, int first, int last)
+{
+        if (this == &other)
         {
-                if (i == index)
-                {
-                        curr->data = element;
-                        return;
-                }
-                curr = curr->next;
+                throw runtime_error("cannot splice a doubly-linked list "
+                                        "into itself");
+        }
+        ensure_in_range(pos, 0, length);
+        ensure_in_range(first, 0, other.length);
+        ensure_in_range(last, first, other.length);
+        if (first == last)
+        {
+                return;
+        }
+        Node *first_node = other.node_at(first);
+        Node *last_node = other.node_at(last-1);
+        Node *before = first_node->prev;
+        Node *after = last_node->next;
+        if (before == nullptr)
+        {
+                other.front = after;
+        }
+        else
+        {
+                before->next = after;
+        }
+        if (after == nullptr)
+        {
+                other.back = before;
+        }
+        else
+        {
+                after->prev = before;
         }
+        other.length -= last - first;
+        other.forget_cursor();
+        forget_cursor();
+        Node *prev = (pos == 0) ? nullptr : node_at(pos-1);
+        link_range(prev, first_node, last_node, last - first);
+}
+
+//append function
+//Parameters: LinkedList &&other, LinkedList being moved onto the back
+//Returns: Nothing
+//Does: Links the nodes of other after the back of this LinkedList in
+//      O(1), leaving other empty
+template<typename ElemType>
+void LinkedList<ElemType>::append(LinkedList &&other)
+{
+        if (this == &other)
+        {
+                throw runtime_error("cannot append a doubly-linked list "
+                                        "to itself");
+        }
+        if (other.length == 0)
+        {
+                return;
+        }
+        link_range(back, other.front, other.back, other.length);
+        other.front = other.back = nullptr;
+        other.length = 0;
+        other.forget_cursor();
+}
+
+//split_at function
+//Parameters: int index, index of the first element moved out
+//Returns: LinkedList - the elements from index to the back
+//Does: Cuts the LinkedList in two, keeping the elements before index.
+//      Only the node at index is looked up, the tail is handed over
+//      without copying
+template<typename ElemType>
+LinkedList<ElemType> LinkedList<ElemType>::split_at(int index)
+{
+        ensure_in_range(index, 0, length);
+        LinkedList rest;
+        if (index == length)
+        {
+                return rest;
+        }
+        Node *first_node = node_at(index);
+        rest.front = first_node;
+        rest.back = back;
+        rest.length = length - index;
+        back = first_node->prev;
+        if (back == nullptr)
+        {
+                front = nullptr;
+        }
+        else
+        {
+                back->next = nullptr;
+        }
+        first_node->prev = nullptr;
+        length = index;
+        if (cursor_index >= index)
+        {
+                forget_cursor();
+        }
+        return rest;
 }
 
 //copy_linked_list function
@@ -442,10 +663,12 @@ template<typename ElemType>
 void LinkedList<ElemType>::copy_linked_list(const LinkedList &rhs)
 {
         length = rhs.length;
+        forget_cursor();
     
         if (rhs.front == nullptr)
         {
                 front = nullptr;
+                back = nullptr;
                 return;
         }
         front = new Node(rhs.front->data, nullptr, nullptr);
@@ -459,6 +682,7 @@ void LinkedList<ElemType>::copy_linked_list(const LinkedList &rhs)
             curr = curr->next;
             orig = orig->next;
         }
+        back = curr;
 }
 
 //ensure_in_range function
@@ -482,47 +706,148 @@ void LinkedList<ElemType>::ensure_in_range(int index, int low, int high)
 //            int index, index that is being accessed
 //Return: Nothing 
 //Does: inserts the element value at the given index if the index is 
-//      not equal to 0 or the length of the linkedlist
+//      not equal to 0 or the length of the linkedlist, leaving the
+//      cursor on the new node
 template<typename ElemType>
 void LinkedList<ElemType>::insert_in_middle(ElemType element, int index)
 {
-        Node *curr = front;
-        for (int i = 0; i <= index; i++)
-        {
-                if (i == index)
-                {
-                        Node *last = curr->prev;
-                        Node *elem_new = new Node(element, curr, curr->prev);
-                        curr->prev = elem_new;
-                        last->next = elem_new;
-                        length++;
-                        return;
-                }
-                curr = curr->next;
-        }
+        Node *curr = node_at(index);
+        Node *last = curr->prev;
+        Node *elem_new = new Node(element, curr, curr->prev);
+        curr->prev = elem_new;
+        last->next = elem_new;
+        length++;
+        cursor = elem_new;
+        cursor_index = index;
 }
 
 //remove_from_middle function
 //Parameters: int index, index being accessed
 //Returns: Nothing
 //Does: deletes the node at the given index if the index is not equal to 
-//      0 or equal to the length of the linkedlist
+//      0 or equal to the length of the linkedlist, leaving the cursor
+//      on the node that moves into the index
 template<typename ElemType>
 void LinkedList<ElemType>::remove_from_middle(int index)
+{
+        Node *curr = node_at(index);
+        Node *next_one = curr->next;
+        Node *prev_one = curr->prev;
+        delete curr;
+        next_one->prev = prev_one;
+        prev_one->next = next_one;
+        length--;
+        cursor = next_one;
+        cursor_index = index;
+}
+
+//link_after function
+//Parameters: Node *prev, node the new one follows, nullptr for the front
+//            ElemType element, value stored in the new node
+//Returns: Node - the new node
+//Does: Allocates a node and links it in right after prev
+template<typename ElemType>
+typename LinkedList<ElemType>::Node *LinkedList<ElemType>::link_after(Node *prev, ElemType element)
+{
+        Node *next_one = (prev == nullptr) ? front : prev->next;
+        Node *elem_new = new Node(element, next_one, prev);
+        if (prev == nullptr)
+        {
+                front = elem_new;
+        }
+        else
+        {
+                prev->next = elem_new;
+        }
+        if (next_one == nullptr)
+        {
+                back = elem_new;
+        }
+        else
+        {
+                next_one->prev = elem_new;
+        }
+        length++;
+        return elem_new;
+}
+
+//node_at function
+//Parameters: int index, index of a stored element
+//Returns: Node - the node at index
+//Does: Walks from the front, the back or the cursor, whichever is
+//      closest, and moves the cursor to the node found. Sequential and
+//      near sequential accesses then cost O(1) each
+template<typename ElemType>
+typename LinkedList<ElemType>::Node *LinkedList<ElemType>::node_at(int index)
 {
         Node *curr = front;
-        for (int i = 0; i <= index; i++)
+        int curr_index = 0;
+        int distance = index;
+        if (length - 1 - index < distance)
+        {
+                curr = back;
+                curr_index = length - 1;
+                distance = length - 1 - index;
+        }
+        if (cursor != nullptr and abs(index - cursor_index) < distance)
+        {
+                curr = cursor;
+                curr_index = cursor_index;
+        }
+        while (curr_index < index)
         {
-                if (i == index)
-                {
-                        Node *next_one = curr->next;
-                        Node *prev_one = curr->prev;
-                        delete curr;
-                        next_one->prev = prev_one;
-                        prev_one->next = next_one;
-                        length--;
-                        return;
-                }
                 curr = curr->next;
+                curr_index++;
+        }
+        while (curr_index > index)
+        {
+                curr = curr->prev;
+                curr_index--;
+        }
+        cursor = curr;
+        cursor_index = index;
+        return curr;
+}
+
+//forget_cursor function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Drops the cached cursor after a change that moves nodes around
+template<typename ElemType>
+void LinkedList<ElemType>::forget_cursor()
+{
+        cursor = nullptr;
+        cursor_index = 0;
+}
+
+//link_range function
+//Parameters: Node *prev, node the chain follows, nullptr for the front
+//            Node *first_node, Node *last_node, ends of an unlinked chain
+//            int count, number of nodes in the chain
+//Returns: Nothing
+//Does: Links an existing chain of nodes in after prev
+template<typename ElemType>
+void LinkedList<ElemType>::link_range(Node *prev, Node *first_node, Node *last_node,
+                                      int count)
+{
+        Node *next_one = (prev == nullptr) ? front : prev->next;
+        first_node->prev = prev;
+        last_node->next = next_one;
+        if (prev == nullptr)
+        {
+                front = first_node;
+        }
+        else
+        {
+                prev->next = first_node;
+        }
+        if (next_one == nullptr)
+        {
+                back = last_node;
+        }
+        else
+        {
+                next_one->prev = last_node;
         }
+        length += count;
 }
\ No newline at end of file
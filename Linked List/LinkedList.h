@@ -24,10 +24,14 @@ class LinkedList
                 LinkedList(ElemType *array, int size);
                 //copy constructor
                 LinkedList(const LinkedList &rhs);
+                //move constructor
+                LinkedList(LinkedList &&rhs);
                 //destructor
                 ~LinkedList();
                 //equal assignment operator
                 LinkedList &operator=(const LinkedList &rhs);
+                //move assignment operator
+                LinkedList &operator=(LinkedList &&rhs);
                 //checks if LinkedList is empty
                 bool is_empty();
                 //clears the entire LinkedList
@@ -50,6 +54,10 @@ class LinkedList
                 void insert_at(ElemType element, int index);
                 //inserts element by value in ascending order
                 void insert_in_order(ElemType element);
+                //merges an ascending array of elements into a sorted list
+                void insert_sorted_range(ElemType *array, int size);
+                //sorts the elements in ascending order
+                void sort();
                 //removes an element from the front
                 void pop_from_front();
                 //removes an element from the back 
@@ -58,6 +66,12 @@ class LinkedList
                 void remove_at(int index);
                 //replaces value at a given index
                 void replace_at(ElemType element, int index);
+                //moves elements first to last-1 of other in front of index pos
+                void splice(int pos, LinkedList &other, int first, int last);
+                //moves every element of other onto the back
+                void append(LinkedList &&other);
+                //moves the elements from index onward into a new LinkedList
+                LinkedList split_at(int index);
 
         private:
 
@@ -78,8 +92,14 @@ class LinkedList
 
                 //pointer to front of the LinkedList
                 Node *front;
+                //pointer to back of the LinkedList
+                Node *back;
                 //length of the LinkedList
                 int length;
+                //last node looked up by index, nullptr when unknown
+                Node *cursor;
+                //index of the cursor node
+                int cursor_index;
 
                 //copies values from one object to another
                 void copy_linked_list(const LinkedList &rhs);
@@ -89,6 +109,16 @@ class LinkedList
                 void insert_in_middle(ElemType element, int index);
                 //removes value from middle of a LinkedList
                 void remove_from_middle(int index);
+                //links a new node after prev (at the front if prev is nullptr)
+                Node *link_after(Node *prev, ElemType element);
+                //returns the node at index, walking from the nearest of
+                //the front, the back and the cursor
+                Node *node_at(int index);
+                //drops the cached cursor
+                void forget_cursor();
+                //links the chain first_node to last_node in after prev
+                void link_range(Node *prev, Node *first_node, Node *last_node,
+                                int count);
 
 };
 
@@ -0,0 +1,560 @@
+/*
+ *
+ * Unrolled LinkedList Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * UnrolledLinkedList.cpp
+ * Full function implementation
+ *
+ */
+
+#include "UnrolledLinkedList.h"
+
+#include <iostream>
+
+using namespace std;
+
+//default constructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Initializes an empty instance of the UnrolledLinkedList class
+template<typename ElemType, int BlockSize>
+UnrolledLinkedList<ElemType, BlockSize>::UnrolledLinkedList()
+{
+        front = back = nullptr;
+        length = 0;
+}
+
+//element constructor
+//Parameters: ElemType element, item being initially added to the list
+//Returns: Nothing
+//Does: Initializes an instance of the class with one item
+//      stored initially
+template<typename ElemType, int BlockSize>
+UnrolledLinkedList<ElemType, BlockSize>::UnrolledLinkedList(ElemType element)
+{
+        front = back = nullptr;
+        length = 0;
+        push_at_back(element);
+}
+
+//array constructor
+//Parameters: ElemType *array, array being added to the list
+//            int size, length of the array
+//Returns: Nothing
+//Does: Initializes the list with the values stored in the passed in
+//      array, packing every node to full capacity
+template<typename ElemType, int BlockSize>
+UnrolledLinkedList<ElemType, BlockSize>::UnrolledLinkedList(ElemType *array,
+                                                            int size)
+{
+        front = back = nullptr;
+        length = 0;
+        for (int i = 0; i < size; i++)
+        {
+                push_at_back(array[i]);
+        }
+}
+
+//copy constructor
+//Parameters: const UnrolledLinkedList &rhs, second instance of the class
+//Returns: Nothing
+//Does: Creates a second object using a passed in instance
+template<typename ElemType, int BlockSize>
+UnrolledLinkedList<ElemType, BlockSize>::UnrolledLinkedList(
+                                        const UnrolledLinkedList &rhs)
+{
+        front = back = nullptr;
+        length = 0;
+        copy_list(rhs);
+}
+
+//destructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Deallocates dynamically allocated memory
+template<typename ElemType, int BlockSize>
+UnrolledLinkedList<ElemType, BlockSize>::~UnrolledLinkedList()
+{
+        clear();
+}
+
+//assignment operator
+//Parameters: const UnrolledLinkedList &rhs, second instance of the class
+//Returns: UnrolledLinkedList<ElemType, BlockSize>
+//Does: Copies all values stored in the passed in object into the
+//      current object
+template<typename ElemType, int BlockSize>
+UnrolledLinkedList<ElemType, BlockSize> &
+UnrolledLinkedList<ElemType, BlockSize>::operator=(const UnrolledLinkedList &rhs)
+{
+        if (this == &rhs)
+        {
+                return *this;
+        }
+        clear();
+        copy_list(rhs);
+        return *this;
+}
+
+//is_empty function
+//Parameters: Nothing
+//Returns: bool
+//Does: Checks if the list is empty
+template<typename ElemType, int BlockSize>
+bool UnrolledLinkedList<ElemType, BlockSize>::is_empty()
+{
+        return length == 0;
+}
+
+//clear function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Clears the items stored in the list
+template<typename ElemType, int BlockSize>
+void UnrolledLinkedList<ElemType, BlockSize>::clear()
+{
+        Node *curr = front;
+        while (curr != nullptr)
+        {
+                Node *temp = curr;
+                curr = curr->next;
+                delete temp;
+        }
+        front = back = nullptr;
+        length = 0;
+}
+
+//size function
+//Parameters: Nothing
+//Returns: int
+//Does: Returns the number of items stored in the list
+template<typename ElemType, int BlockSize>
+int UnrolledLinkedList<ElemType, BlockSize>::size()
+{
+        return length;
+}
+
+//first function
+//Parameters: Nothing
+//Returns: ElemType
+//Does: Returns the first element in the list
+template<typename ElemType, int BlockSize>
+ElemType UnrolledLinkedList<ElemType, BlockSize>::first()
+{
+        if (length == 0)
+        {
+                throw runtime_error("cannot get first "
+                                        "of empty unrolled linked list");
+        }
+        return front->data[0];
+}
+
+//last function
+//Parameters: Nothing
+//Returns: ElemType
+//Does: Returns the last element in the list
+template<typename ElemType, int BlockSize>
+ElemType UnrolledLinkedList<ElemType, BlockSize>::last()
+{
+        if (length == 0)
+        {
+                throw runtime_error("cannot get last "
+                                        "of empty unrolled linked list");
+        }
+        return back->data[back->count-1];
+}
+
+//element_at function
+//Parameters: int index, index being accessed
+//Returns: ElemType
+//Does: Returns the element stored at the given index
+template<typename ElemType, int BlockSize>
+ElemType UnrolledLinkedList<ElemType, BlockSize>::element_at(int index)
+{
+        ensure_in_range(index, 0, length-1);
+        int offset;
+        Node *node = find_node(index, offset);
+        return node->data[offset];
+}
+
+//print function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Prints the elements of the list
+template<typename ElemType, int BlockSize>
+void UnrolledLinkedList<ElemType, BlockSize>::print()
+{
+        cout << "[UnrolledLinkedList of size " << length << " <<";
+        for (Node *curr = front; curr != nullptr; curr = curr->next)
+        {
+                for (int i = 0; i < curr->count; i++)
+                {
+                        cout << curr->data[i];
+                }
+        }
+        cout << ">>]" << endl;
+}
+
+//push_at_back function
+//Parameters: ElemType element, element being added to the back of the list
+//Returns: Nothing
+//Does: Adds an element to the back of the list, starting a new node
+//      only when the last one is full
+template<typename ElemType, int BlockSize>
+void UnrolledLinkedList<ElemType, BlockSize>::push_at_back(ElemType element)
+{
+        if (back == nullptr or back->count == BlockSize)
+        {
+                link_after(back);
+        }
+        back->data[back->count] = element;
+        back->count++;
+        length++;
+}
+
+//push_at_front function
+//Parameters: ElemType element, element being added to the list
+//Returns: Nothing
+//Does: Adds an element to the front of the list, starting a new node
+//      only when the first one is full
+template<typename ElemType, int BlockSize>
+void UnrolledLinkedList<ElemType, BlockSize>::push_at_front(ElemType element)
+{
+        if (front == nullptr or front->count == BlockSize)
+        {
+                link_after(nullptr);
+        }
+        insert_into_node(front, 0, element);
+}
+
+//insert_at function
+//Parameters: ElemType element, element added to the list
+//            int index, index being accessed
+//Returns: Nothing
+//Does: Inserts a given element at the passed in index
+template<typename ElemType, int BlockSize>
+void UnrolledLinkedList<ElemType, BlockSize>::insert_at(ElemType element,
+                                                        int index)
+{
+        ensure_in_range(index, 0, length);
+        if (index == 0)
+        {
+                push_at_front(element);
+                return;
+        }
+        if (index == length)
+        {
+                push_at_back(element);
+                return;
+        }
+        int offset;
+        Node *node = find_node(index, offset);
+        insert_into_node(node, offset, element);
+}
+
+//insert_in_order function
+//Parameters: ElemType element, item added to the list
+//Returns: Nothing
+//Does: Inserts the element before the first larger value, scanning
+//      each node's array in place and inserting during the same pass
+template<typename ElemType, int BlockSize>
+void UnrolledLinkedList<ElemType, BlockSize>::insert_in_order(ElemType element)
+{
+        for (Node *curr = front; curr != nullptr; curr = curr->next)
+        {
+                for (int i = 0; i < curr->count; i++)
+                {
+                        if (element < curr->data[i])
+                        {
+                                insert_into_node(curr, i, element);
+                                return;
+                        }
+                }
+        }
+        push_at_back(element);
+}
+
+//pop_from_front function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Deletes first item stored in the list
+template<typename ElemType, int BlockSize>
+void UnrolledLinkedList<ElemType, BlockSize>::pop_from_front()
+{
+        if (length == 0)
+        {
+                throw runtime_error("cannot pop from "
+                                        "empty unrolled linked list");
+        }
+        remove_from_node(front, 0);
+}
+
+//pop_from_back function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Removes last element in the list
+template<typename ElemType, int BlockSize>
+void UnrolledLinkedList<ElemType, BlockSize>::pop_from_back()
+{
+        if (length == 0)
+        {
+                throw runtime_error("cannot pop from "
+                                        "empty unrolled linked list");
+        }
+        remove_from_node(back, back->count-1);
+}
+
+//remove_at function
+//Parameters: int index, index being removed
+//Returns: Nothing
+//Does: Removes the element stored at the passed in index
+template<typename ElemType, int BlockSize>
+void UnrolledLinkedList<ElemType, BlockSize>::remove_at(int index)
+{
+        ensure_in_range(index, 0, length-1);
+        int offset;
+        Node *node = find_node(index, offset);
+        remove_from_node(node, offset);
+}
+
+//replace_at function
+//Parameters: ElemType element, value that is being stored
+//            int index, index that is being accessed
+//Returns: Nothing
+//Does: Replaces the value at the given index with the passed in value
+template<typename ElemType, int BlockSize>
+void UnrolledLinkedList<ElemType, BlockSize>::replace_at(ElemType element,
+                                                         int index)
+{
+        ensure_in_range(index, 0, length-1);
+        int offset;
+        Node *node = find_node(index, offset);
+        node->data[offset] = element;
+}
+
+//copy_list function
+//Parameters: const UnrolledLinkedList &rhs, second instance of the class
+//Returns: Nothing
+//Does: Copies the items in one list into the current (empty) instance,
+//      keeping the same node layout
+template<typename ElemType, int BlockSize>
+void UnrolledLinkedList<ElemType, BlockSize>::copy_list(
+                                        const UnrolledLinkedList &rhs)
+{
+        for (Node *orig = rhs.front; orig != nullptr; orig = orig->next)
+        {
+                Node *node = link_after(back);
+                for (int i = 0; i < orig->count; i++)
+                {
+                        node->data[i] = orig->data[i];
+                }
+                node->count = orig->count;
+        }
+        length = rhs.length;
+}
+
+//ensure_in_range function
+//Parameters: int index, index being accessed
+//            int low, lowest index possible
+//            int high, highest index possible
+//Returns: Nothing
+//Does: Checks if a index is within the passed in high and low values
+template<typename ElemType, int BlockSize>
+void UnrolledLinkedList<ElemType, BlockSize>::ensure_in_range(int index,
+                                                              int low,
+                                                              int high)
+{
+        if (index < low or index > high)
+        {
+                throw range_error("Index accessed is not in range");
+        }
+}
+
+//find_node function
+//Parameters: int index, index of the element being looked for
+//            int &offset, set to the position of the element within
+//                         the returned node
+//Returns: Node, the node storing the element at the index
+//Does: Walks node by node from whichever end of the list is closer
+template<typename ElemType, int BlockSize>
+typename UnrolledLinkedList<ElemType, BlockSize>::Node *
+UnrolledLinkedList<ElemType, BlockSize>::find_node(int index, int &offset)
+{
+        if (index < length / 2)
+        {
+                Node *curr = front;
+                while (index >= curr->count)
+                {
+                        index -= curr->count;
+                        curr = curr->next;
+                }
+                offset = index;
+                return curr;
+        }
+        Node *curr = back;
+        int remaining = length - 1 - index;
+        while (remaining >= curr->count)
+        {
+                remaining -= curr->count;
+                curr = curr->prev;
+        }
+        offset = curr->count - 1 - remaining;
+        return curr;
+}
+
+//insert_into_node function
+//Parameters: Node *node, node the element is being added to
+//            int offset, position within the node
+//            ElemType element, value being inserted
+//Returns: Nothing
+//Does: Inserts the element into the node. A full node is first split
+//      in half, moving its upper half into a newly linked node
+template<typename ElemType, int BlockSize>
+void UnrolledLinkedList<ElemType, BlockSize>::insert_into_node(Node *node,
+                                                               int offset,
+                                                               ElemType element)
+{
+        if (node->count == BlockSize)
+        {
+                int half = BlockSize / 2;
+                Node *split = link_after(node);
+                for (int i = half; i < BlockSize; i++)
+                {
+                        split->data[i-half] = node->data[i];
+                }
+                split->count = BlockSize - half;
+                node->count = half;
+                if (offset > half)
+                {
+                        node = split;
+                        offset -= half;
+                }
+        }
+        for (int i = node->count; i > offset; i--)
+        {
+                node->data[i] = node->data[i-1];
+        }
+        node->data[offset] = element;
+        node->count++;
+        length++;
+}
+
+//remove_from_node function
+//Parameters: Node *node, node the element is being removed from
+//            int offset, position within the node
+//Returns: Nothing
+//Does: Removes the element from the node. Empty nodes are unlinked and
+//      nodes that drop below half full are merged with, or borrow from,
+//      a neighbour so the list stays densely packed
+template<typename ElemType, int BlockSize>
+void UnrolledLinkedList<ElemType, BlockSize>::remove_from_node(Node *node,
+                                                               int offset)
+{
+        for (int i = offset; i < node->count - 1; i++)
+        {
+                node->data[i] = node->data[i+1];
+        }
+        node->count--;
+        length--;
+        if (node->count == 0)
+        {
+                unlink(node);
+                return;
+        }
+        if (node->count >= BlockSize / 2)
+        {
+                return;
+        }
+        Node *next = node->next;
+        if (next == nullptr)
+        {
+                //last node, fold it back into its predecessor if it fits
+                Node *prev = node->prev;
+                if (prev != nullptr and prev->count + node->count <= BlockSize)
+                {
+                        for (int i = 0; i < node->count; i++)
+                        {
+                                prev->data[prev->count+i] = node->data[i];
+                        }
+                        prev->count += node->count;
+                        unlink(node);
+                }
+                return;
+        }
+        if (node->count + next->count <= BlockSize)
+        {
+                for (int i = 0; i < next->count; i++)
+                {
+                        node->data[node->count+i] = next->data[i];
+                }
+                node->count += next->count;
+                unlink(next);
+                return;
+        }
+        node->data[node->count] = next->data[0];
+        node->count++;
+        for (int i = 0; i < next->count - 1; i++)
+        {
+                next->data[i] = next->data[i+1];
+        }
+        next->count--;
+}
+
+//link_after function
+//Parameters: Node *node, node the new one is linked after (nullptr
+//                        links the new node at the front)
+//Returns: Node, the newly created empty node
+//Does: Allocates an empty node and links it into the list
+template<typename ElemType, int BlockSize>
+typename UnrolledLinkedList<ElemType, BlockSize>::Node *
+UnrolledLinkedList<ElemType, BlockSize>::link_after(Node *node)
+{
+        Node *next = (node == nullptr) ? front : node->next;
+        Node *a_new = new Node(next, node);
+        if (node == nullptr)
+        {
+                front = a_new;
+        }
+        else
+        {
+                node->next = a_new;
+        }
+        if (next == nullptr)
+        {
+                back = a_new;
+        }
+        else
+        {
+                next->prev = a_new;
+        }
+        return a_new;
+}
+
+//unlink function
+//Parameters: Node *node, node being removed from the list
+//Returns: Nothing
+//Does: Removes the node from the list and deletes it. The elements it
+//      still holds are not counted in length
+template<typename ElemType, int BlockSize>
+void UnrolledLinkedList<ElemType, BlockSize>::unlink(Node *node)
+{
+        if (node->prev == nullptr)
+        {
+                front = node->next;
+        }
+        else
+        {
+                node->prev->next = node->next;
+        }
+        if (node->next == nullptr)
+        {
+                back = node->prev;
+        }
+        else
+        {
+                node->next->prev = node->prev;
+        }
+        delete node;
+}
\ No newline at end of file
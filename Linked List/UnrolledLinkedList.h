@@ -0,0 +1,109 @@
+/*
+ *
+ * Unrolled LinkedList Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * UnrolledLinkedList.h
+ * Header and function declarations
+ *
+ * Each node stores a small inline array of elements instead of a single
+ * element, so scans walk contiguous memory and the next/prev pointer
+ * overhead is shared by a whole block. BlockSize defaults to roughly
+ * two 64 byte cache lines worth of elements.
+ *
+ */
+
+#ifndef UNROLLEDLINKEDLIST_H_
+#define UNROLLEDLINKEDLIST_H_
+
+template<typename ElemType,
+         int BlockSize = (sizeof(ElemType) >= 32 ? 4 : 128 / sizeof(ElemType))>
+class UnrolledLinkedList
+{
+        public:
+                //default constructor
+                UnrolledLinkedList();
+                //single element constructor
+                UnrolledLinkedList(ElemType element);
+                //array constructor
+                UnrolledLinkedList(ElemType *array, int size);
+                //copy constructor
+                UnrolledLinkedList(const UnrolledLinkedList &rhs);
+                //destructor
+                ~UnrolledLinkedList();
+                //equal assignment operator
+                UnrolledLinkedList &operator=(const UnrolledLinkedList &rhs);
+                //checks if the list is empty
+                bool is_empty();
+                //clears the entire list
+                void clear();
+                //returns number of elements
+                int size();
+                //returns first value stored in the list
+                ElemType first();
+                //returns last value stored in the list
+                ElemType last();
+                //returns the element at a given index
+                ElemType element_at(int index);
+                //prints values
+                void print();
+                //adds an element to the back
+                void push_at_back(ElemType element);
+                //adds an element to the front
+                void push_at_front(ElemType element);
+                //inserts element at a given index
+                void insert_at(ElemType element, int index);
+                //inserts element by value in ascending order
+                void insert_in_order(ElemType element);
+                //removes an element from the front
+                void pop_from_front();
+                //removes an element from the back
+                void pop_from_back();
+                //removes an element from a given index
+                void remove_at(int index);
+                //replaces value at a given index
+                void replace_at(ElemType element, int index);
+
+        private:
+
+                //Node struct, holds up to BlockSize elements
+                struct Node
+                {
+                        ElemType data[BlockSize];
+                        int count;
+                        Node *next;
+                        Node *prev;
+                        //Node constructor function
+                        Node(Node *next_p, Node *prev_p)
+                        {
+                                count = 0;
+                                next = next_p;
+                                prev = prev_p;
+                        }
+                };
+
+                //pointer to front of the list
+                Node *front;
+                //pointer to the back of the list
+                Node *back;
+                //number of elements stored in the list
+                int length;
+
+                //copies values from one object to another
+                void copy_list(const UnrolledLinkedList &rhs);
+                //checks that passed in indices are valid
+                void ensure_in_range(int index, int low, int high);
+                //finds the node holding a given index
+                Node *find_node(int index, int &offset);
+                //inserts value into a node, splitting it if full
+                void insert_into_node(Node *node, int offset, ElemType element);
+                //removes value from a node, merging it if underfull
+                void remove_from_node(Node *node, int offset);
+                //creates a new node after the passed in node
+                Node *link_after(Node *node);
+                //unlinks and deletes a node
+                void unlink(Node *node);
+};
+
+#endif
\ No newline at end of file
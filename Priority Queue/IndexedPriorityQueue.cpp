@@ -0,0 +1,330 @@
+/*
+ *
+ * Indexed Priority Queue Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * IndexedPriorityQueue.cpp
+ * Full function implementation
+ *
+ */
+
+#include "IndexedPriorityQueue.h"
+#include "../Array List/ArrayList.cpp"
+
+using namespace std;
+
+//default constructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Initializes an empty instance of the class
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::IndexedPriorityQueue()
+{
+}
+
+//comparator constructor
+//Parameters: const Compare &comp - the comparator used to order priorities
+//Returns: Nothing
+//Does: Initializes an empty instance of the class that orders its
+//      priorities with the passed in comparator
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::IndexedPriorityQueue(const Compare &comp)
+{
+        compare = comp;
+}
+
+//is_empty function
+//Parameters: Nothing
+//Returns: bool
+//Does: Checks if the queue is empty
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+bool IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::is_empty()
+{
+        return heap.is_empty();
+}
+
+//size function
+//Parameters: Nothing
+//Returns: int
+//Does: Returns the number of ids in the queue
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+int IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::size()
+{
+        return heap.size();
+}
+
+//contains function
+//Parameters: int id, the id being checked for
+//Returns: bool - whether or not the id is in the queue
+//Does: Looks the id up in the position table, O(1)
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+bool IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::contains(int id)
+{
+        return id >= 0 and id < position.size() and position[id] != -1;
+}
+
+//priority_of function
+//Parameters: int id, an id in the queue
+//Returns: ElemType - the priority of the id
+//Does: Returns the current priority of an id, throws if it is not queued
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+ElemType IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::priority_of(int id)
+{
+        ensure_contains(id);
+        return priorities[id];
+}
+
+//top_id function
+//Parameters: Nothing
+//Returns: int - the id with the highest priority
+//Does: Returns the id at the top of the heap
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+int IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::top_id()
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        if (heap.is_empty())
+        {
+                throw runtime_error("Cannot get top of "
+                                        "empty IndexedPriorityQueue");
+        }
+        return heap[0];
+}
+
+//top_priority function
+//Parameters: Nothing
+//Returns: ElemType - the highest priority in the queue
+//Does: Returns the priority of the id at the top of the heap
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+ElemType IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::top_priority()
+{
+        return priorities[top_id()];
+}
+
+//push function
+//Parameters: int id, a non negative id not already in the queue
+//            ElemType priority, the priority of the id
+//Returns: Nothing
+//Does: Adds the id as the last leaf and sifts it up, O(log n)
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+void IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::push(int id, ElemType priority)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
+        ensure_id(id);
+        if (position[id] != -1)
+        {
+                throw runtime_error("Id is already in the "
+                                        "IndexedPriorityQueue");
+        }
+        priorities[id] = priority;
+        heap.push_at_back(id);
+        position[id] = heap.size() - 1;
+        sift_up(heap.size() - 1);
+}
+
+//pop function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Removes the id with the highest priority, O(log n)
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+void IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::pop()
+{
+        if (heap.is_empty())
+        {
+                throw runtime_error("Cannot pop from "
+                                        "empty IndexedPriorityQueue");
+        }
+        remove(heap[0]);
+}
+
+//decrease_key function
+//Parameters: int id, an id in the queue
+//            ElemType priority, a priority that Compare does not order
+//            after the current one
+//Returns: Nothing
+//Does: Lowers the key of the id (moving it toward the top) and sifts it
+//      up, O(log n)
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+void IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::decrease_key(int id, ElemType priority)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
+        ensure_contains(id);
+        StatsPolicy::comparison();
+        if (compare(priorities[id], priority) < 0)
+        {
+                throw runtime_error("decrease_key would move "
+                                        "the id away from the top");
+        }
+        priorities[id] = priority;
+        sift_up(position[id]);
+}
+
+//push_or_update function
+//Parameters: int id, a non negative id
+//            ElemType priority, the new priority of the id
+//Returns: Nothing
+//Does: Adds the id if it is not queued, otherwise changes its priority
+//      in either direction and restores the heap order, O(log n)
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+void IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::push_or_update(int id, ElemType priority)
+{
+        if (!contains(id))
+        {
+                push(id, priority);
+                return;
+        }
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
+        priorities[id] = priority;
+        sift_up(position[id]);
+        sift_down(position[id]);
+}
+
+//remove function
+//Parameters: int id, an id in the queue
+//Returns: Nothing
+//Does: Moves the last leaf into the id's slot and restores the heap
+//      order around it, O(log n)
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+void IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::remove(int id)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
+        ensure_contains(id);
+        int index = position[id];
+        int last = heap[heap.size() - 1];
+        heap.pop_from_back();
+        position[id] = -1;
+        if (last == id)
+        {
+                return;
+        }
+        place(last, index);
+        sift_up(index);
+        sift_down(position[last]);
+}
+
+//stats function
+//Parameters: Nothing
+//Returns: StatsSnapshot - copy of the counters kept by the StatsPolicy
+//Does: Reports comparisons and per operation latencies (all zero
+//      unless the queue is built with OpStats)
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+StatsSnapshot IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::stats()
+{
+        return StatsPolicy::snapshot();
+}
+
+//ensure_id function
+//Parameters: int id, the id about to be used
+//Returns: Nothing
+//Does: Grows the position and priority tables to cover the id
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+void IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::ensure_id(int id)
+{
+        if (id < 0)
+        {
+                throw range_error("Index accessed is not in range");
+        }
+        while (position.size() <= id)
+        {
+                position.push_at_back(-1);
+                priorities.push_at_back(ElemType());
+        }
+}
+
+//ensure_contains function
+//Parameters: int id, the id being checked
+//Returns: Nothing
+//Does: Throws if the id is not in the queue
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+void IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::ensure_contains(int id)
+{
+        if (!contains(id))
+        {
+                throw runtime_error("Id is not in the "
+                                        "IndexedPriorityQueue");
+        }
+}
+
+//sift_up function
+//Parameters: int index, heap slot of the id being moved
+//Returns: Nothing
+//Does: Moves parents down into the hole until the id's place is found
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+void IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::sift_up(int index)
+{
+        int id = heap[index];
+        while (index > 0)
+        {
+                int parent = (index - 1) / Arity;
+                if (!before(id, heap[parent]))
+                {
+                        break;
+                }
+                place(heap[parent], index);
+                index = parent;
+        }
+        place(id, index);
+}
+
+//sift_down function
+//Parameters: int index, heap slot of the id being moved
+//Returns: Nothing
+//Does: Moves the first of the children up into the hole while it comes
+//      before the id
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+void IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::sift_down(int index)
+{
+        int length = heap.size();
+        int id = heap[index];
+        while (true)
+        {
+                int first_child = Arity * index + 1;
+                if (first_child >= length)
+                {
+                        break;
+                }
+                int last_child = first_child + Arity - 1;
+                if (last_child >= length)
+                {
+                        last_child = length - 1;
+                }
+                int best = first_child;
+                for (int i = first_child + 1; i <= last_child; i++)
+                {
+                        if (before(heap[i], heap[best]))
+                        {
+                                best = i;
+                        }
+                }
+                if (!before(heap[best], id))
+                {
+                        break;
+                }
+                place(heap[best], index);
+                index = best;
+        }
+        place(id, index);
+}
+
+//place function
+//Parameters: int id, the id being written
+//            int index, the heap slot it is written to
+//Returns: Nothing
+//Does: Keeps the heap and position table in step
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+void IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::place(int id, int index)
+{
+        heap[index] = id;
+        position[id] = index;
+}
+
+//before function
+//Parameters: int a, int b - ids being compared
+//Returns: bool - true if id a has a higher priority than id b
+//Does: Compares the priorities of two ids, counting the comparison
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+bool IndexedPriorityQueue<ElemType, Compare, Arity, StatsPolicy>::before(int a, int b)
+{
+        StatsPolicy::comparison();
+        return compare(priorities[a], priorities[b]) < 0;
+}
\ No newline at end of file
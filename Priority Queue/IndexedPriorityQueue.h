@@ -0,0 +1,84 @@
+/*
+ *
+ * Indexed Priority Queue Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * IndexedPriorityQueue.h
+ * Header and function declarations
+ *
+ * d-ary heap of integer ids (0, 1, 2, ...), each with a priority of type
+ * ElemType. A position table maps every id to its slot in the heap, so
+ * the priority of an id already in the queue can be changed in O(log n)
+ * instead of pushing a duplicate. This is the decrease-key operation
+ * Dijkstra style searches need.
+ *
+ */
+
+#ifndef INDEXEDPRIORITYQUEUE_H_
+#define INDEXEDPRIORITYQUEUE_H_
+
+#include "../Array List/ArrayList.h"
+#include "../Comparators/ThreeWayCompare.h"
+#include "../Instrumentation/OpStats.h"
+
+template<typename ElemType, typename Compare = ThreeWayCompare, int Arity = 2,
+         typename StatsPolicy = NoStats>
+class IndexedPriorityQueue : private StatsPolicy
+{
+        public:
+                //default constructor
+                IndexedPriorityQueue();
+                //comparator constructor
+                IndexedPriorityQueue(const Compare &comp);
+                //checks if the queue is empty
+                bool is_empty();
+                //returns the number of ids in the queue
+                int size();
+                //checks if an id is in the queue
+                bool contains(int id);
+                //returns the priority of an id in the queue
+                ElemType priority_of(int id);
+                //returns the id with the highest priority
+                int top_id();
+                //returns the highest priority in the queue
+                ElemType top_priority();
+                //adds an id with the given priority
+                void push(int id, ElemType priority);
+                //removes the id with the highest priority
+                void pop();
+                //raises the priority of an id already in the queue
+                void decrease_key(int id, ElemType priority);
+                //sets the priority of an id, adding the id if it is missing
+                void push_or_update(int id, ElemType priority);
+                //removes an id from the queue
+                void remove(int id);
+                //returns a snapshot of the operation counters
+                StatsSnapshot stats();
+
+        private:
+
+                //the heap of ids, heap[0] is the top
+                ArrayList<int> heap;
+                //position[id] is the heap slot of id, -1 if not queued
+                ArrayList<int> position;
+                //priorities[id] is the priority of id while it is queued
+                ArrayList<ElemType> priorities;
+                //orders the priorities
+                Compare compare;
+
+                //grows the id tables so they cover id
+                void ensure_id(int id);
+                //throws if id is not in the queue
+                void ensure_contains(int id);
+                //moves the id in a heap slot up to its place
+                void sift_up(int index);
+                //moves the id in a heap slot down to its place
+                void sift_down(int index);
+                //writes an id into a heap slot and records its position
+                void place(int id, int index);
+                //true if id a should be nearer the top than id b
+                bool before(int a, int b);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,212 @@
+/*
+ *
+ * Priority Queue Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * PriorityQueue.cpp
+ * Full function implementation
+ *
+ */
+
+#include "PriorityQueue.h"
+#include "../Array List/ArrayList.cpp"
+
+using namespace std;
+
+//default constructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Initializes an empty instance of the class
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+PriorityQueue<ElemType, Compare, Arity, StatsPolicy>::PriorityQueue()
+{
+}
+
+//comparator constructor
+//Parameters: const Compare &comp - the comparator used to order elements
+//Returns: Nothing
+//Does: Initializes an empty instance of the class that orders its
+//      elements with the passed in comparator
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+PriorityQueue<ElemType, Compare, Arity, StatsPolicy>::PriorityQueue(const Compare &comp)
+{
+        compare = comp;
+}
+
+//heapify constructor
+//Parameters: const ArrayList<ElemType> &items - elements to start with
+//            const Compare &comp - the comparator used to order elements
+//Returns: Nothing
+//Does: Copies the list and sifts down every node that has a child,
+//      starting from the last one, which builds the heap in O(n). With
+//      fewer than two elements no node has a child, so nothing is sifted
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+PriorityQueue<ElemType, Compare, Arity, StatsPolicy>::PriorityQueue(
+                const ArrayList<ElemType> &items, const Compare &comp)
+        : heap(items)
+{
+        compare = comp;
+        if (heap.size() < 2)
+        {
+                return;
+        }
+        for (int i = (heap.size() - 2) / Arity; i >= 0; i--)
+        {
+                sift_down(i);
+        }
+}
+
+//is_empty function
+//Parameters: Nothing
+//Returns: bool
+//Does: Checks if the PriorityQueue is empty
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+bool PriorityQueue<ElemType, Compare, Arity, StatsPolicy>::is_empty()
+{
+        return heap.is_empty();
+}
+
+//size function
+//Parameters: Nothing
+//Returns: int
+//Does: Returns the number of items stored in the PriorityQueue
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+int PriorityQueue<ElemType, Compare, Arity, StatsPolicy>::size()
+{
+        return heap.size();
+}
+
+//top function
+//Parameters: Nothing
+//Returns: ElemType
+//Does: Returns the element with the highest priority
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+ElemType PriorityQueue<ElemType, Compare, Arity, StatsPolicy>::top()
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        if (heap.is_empty())
+        {
+                throw runtime_error("Cannot get top of "
+                                        "empty PriorityQueue");
+        }
+        return heap[0];
+}
+
+//push function
+//Parameters: ElemType element, item being added
+//Returns: Nothing
+//Does: Adds the element as the last leaf and sifts it up, O(log n)
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+void PriorityQueue<ElemType, Compare, Arity, StatsPolicy>::push(ElemType element)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
+        heap.push_at_back(element);
+        sift_up(heap.size() - 1);
+}
+
+//pop function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Moves the last leaf to the top and sifts it down, O(log n)
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+void PriorityQueue<ElemType, Compare, Arity, StatsPolicy>::pop()
+{
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
+        if (heap.is_empty())
+        {
+                throw runtime_error("Cannot pop from "
+                                        "empty PriorityQueue");
+        }
+        heap[0] = heap[heap.size() - 1];
+        heap.pop_from_back();
+        if (!heap.is_empty())
+        {
+                sift_down(0);
+        }
+}
+
+//stats function
+//Parameters: Nothing
+//Returns: StatsSnapshot - copy of the counters kept by the StatsPolicy
+//Does: Reports comparisons and per operation latencies (all zero
+//      unless the PriorityQueue is built with OpStats)
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+StatsSnapshot PriorityQueue<ElemType, Compare, Arity, StatsPolicy>::stats()
+{
+        return StatsPolicy::snapshot();
+}
+
+//sift_up function
+//Parameters: int index, position of the element being moved
+//Returns: Nothing
+//Does: Moves parents down into the hole until the element's place is
+//      found, then writes the element once
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+void PriorityQueue<ElemType, Compare, Arity, StatsPolicy>::sift_up(int index)
+{
+        ElemType element = heap[index];
+        while (index > 0)
+        {
+                int parent = (index - 1) / Arity;
+                if (!before(element, heap[parent]))
+                {
+                        break;
+                }
+                heap[index] = heap[parent];
+                index = parent;
+        }
+        heap[index] = element;
+}
+
+//sift_down function
+//Parameters: int index, position of the element being moved
+//Returns: Nothing
+//Does: Moves the first of the children up into the hole while it comes
+//      before the element, then writes the element once
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+void PriorityQueue<ElemType, Compare, Arity, StatsPolicy>::sift_down(int index)
+{
+        int length = heap.size();
+        ElemType element = heap[index];
+        while (true)
+        {
+                int first_child = Arity * index + 1;
+                if (first_child >= length)
+                {
+                        break;
+                }
+                int last_child = first_child + Arity - 1;
+                if (last_child >= length)
+                {
+                        last_child = length - 1;
+                }
+                int best = first_child;
+                for (int i = first_child + 1; i <= last_child; i++)
+                {
+                        if (before(heap[i], heap[best]))
+                        {
+                                best = i;
+                        }
+                }
+                if (!before(heap[best], element))
+                {
+                        break;
+                }
+                heap[index] = heap[best];
+                index = best;
+        }
+        heap[index] = element;
+}
+
+//before function
+//Parameters: const ElemType &a, const ElemType &b - elements compared
+//Returns: bool - true if a has a higher priority than b
+//Does: Compares two elements with the comparator, counting the comparison
+template<typename ElemType, typename Compare, int Arity, typename StatsPolicy>
+bool PriorityQueue<ElemType, Compare, Arity, StatsPolicy>::before(const ElemType &a,
+                                                        const ElemType &b)
+{
+        StatsPolicy::comparison();
+        return compare(a, b) < 0;
+}
\ No newline at end of file
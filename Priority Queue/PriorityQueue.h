@@ -0,0 +1,66 @@
+/*
+ *
+ * Priority Queue Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * PriorityQueue.h
+ * Header and function declarations
+ *
+ * Implicit d-ary heap stored in an ArrayList. The element at index i has
+ * its children at Arity*i+1 through Arity*i+Arity, and top() is the
+ * element that Compare orders first (the smallest with the default
+ * ThreeWayCompare). Arity = 2 is a binary heap. Arity = 4 makes the heap
+ * half as deep and keeps each node's children next to each other in
+ * memory, which usually makes push and pop faster on large heaps.
+ *
+ */
+
+#ifndef PRIORITYQUEUE_H_
+#define PRIORITYQUEUE_H_
+
+#include "../Array List/ArrayList.h"
+#include "../Comparators/ThreeWayCompare.h"
+#include "../Instrumentation/OpStats.h"
+
+template<typename ElemType, typename Compare = ThreeWayCompare, int Arity = 2,
+         typename StatsPolicy = NoStats>
+class PriorityQueue : private StatsPolicy
+{
+        public:
+                //default constructor
+                PriorityQueue();
+                //comparator constructor
+                PriorityQueue(const Compare &comp);
+                //heapify constructor, builds the heap from a list in O(n)
+                PriorityQueue(const ArrayList<ElemType> &items,
+                              const Compare &comp = Compare());
+                //checks if the PriorityQueue is empty
+                bool is_empty();
+                //returns the number of items in the PriorityQueue
+                int size();
+                //returns the element with the highest priority
+                ElemType top();
+                //adds an element
+                void push(ElemType element);
+                //removes the element with the highest priority
+                void pop();
+                //returns a snapshot of the operation counters
+                StatsSnapshot stats();
+
+        private:
+
+                //the heap, heap[0] is the top
+                ArrayList<ElemType> heap;
+                //orders the elements
+                Compare compare;
+
+                //moves the element at index up until its parent is not after it
+                void sift_up(int index);
+                //moves the element at index down until no child is before it
+                void sift_down(int index);
+                //true if a should be nearer the top than b
+                bool before(const ElemType &a, const ElemType &b);
+};
+
+#endif
\ No newline at end of file
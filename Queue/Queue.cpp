@@ -9,6 +9,9 @@
  * 
  */
 
+#ifndef QUEUE_CPP_
+#define QUEUE_CPP_
+
 #include "Queue.h"
 #include <iostream>
 
@@ -18,10 +21,11 @@ using namespace std;
 //Parameters: Nothing
 //Returns: Nothing
 //Does: Initializes an instance of the class
-template<typename ElemType>
-Queue<ElemType>::Queue()
+template<typename ElemType, typename StatsPolicy>
+Queue<ElemType, StatsPolicy>::Queue()
 {
         array = nullptr;
+        head = 0;
         num_items = 0;
         max_capacity = 0;
 }
@@ -30,8 +34,8 @@ Queue<ElemType>::Queue()
 //Parameters: Nothing
 //Returns: Nothing
 //Does: Deletes all dynamically allocated memory
-template<typename ElemType>
-Queue<ElemType>::~Queue()
+template<typename ElemType, typename StatsPolicy>
+Queue<ElemType, StatsPolicy>::~Queue()
 {
         num_items = max_capacity = -1;
         delete [] array;
@@ -43,22 +47,23 @@ Queue<ElemType>::~Queue()
 //Returns: Nothing
 //Does: Creates new instance of the Queue Class and copies
 //      the values stored in object passed in
-template<typename ElemType>
-Queue<ElemType>::Queue(const Queue &rhs)
+template<typename ElemType, typename StatsPolicy>
+Queue<ElemType, StatsPolicy>::Queue(const Queue &rhs)
 {
         num_items = rhs.num_items;
         array = new ElemType[num_items];
+        head = 0;
         max_capacity = num_items;
-        copy_array(rhs.array, array, num_items);
+        copy_array(rhs.array, rhs.head, rhs.max_capacity, array, num_items);
 }
 
 //assignment operator
 //Parameters: const Queue &rhs, second instance of the class
-//Returns: Queue<ElemType>
+//Returns: Queue<ElemType, StatsPolicy>
 //Does: Copies all values stored in the passed in object into the
 //      current object
-template<typename ElemType>
-Queue<ElemType> &Queue<ElemType>::operator=(const Queue &rhs)
+template<typename ElemType, typename StatsPolicy>
+Queue<ElemType, StatsPolicy> &Queue<ElemType, StatsPolicy>::operator=(const Queue &rhs)
 {
         if (this == &rhs)
         {
@@ -69,7 +74,8 @@ Queue<ElemType> &Queue<ElemType>::operator=(const Queue &rhs)
 
         delete [] array;
         array = new ElemType[max_capacity];
-        copy_array(rhs.array, array, num_items);
+        head = 0;
+        copy_array(rhs.array, rhs.head, rhs.max_capacity, array, num_items);
         return *this;
 }
 
@@ -77,8 +83,8 @@ Queue<ElemType> &Queue<ElemType>::operator=(const Queue &rhs)
 //Parameters: Nothing
 //Returns: bool
 //Does: Checks if a queue is empty
-template<typename ElemType>
-bool Queue<ElemType>::is_empty()
+template<typename ElemType, typename StatsPolicy>
+bool Queue<ElemType, StatsPolicy>::is_empty()
 {
         if (num_items == 0)
         {
@@ -92,8 +98,8 @@ bool Queue<ElemType>::is_empty()
 //Returns: int
 //Does: Returns the number of items stored 
 //      within the Queue
-template<typename ElemType>
-int Queue<ElemType>::size()
+template<typename ElemType, typename StatsPolicy>
+int Queue<ElemType, StatsPolicy>::size()
 {
         return num_items;
 }
@@ -102,107 +108,133 @@ int Queue<ElemType>::size()
 //Parameters: Nothing
 //Returns: ElemType
 //Does: Returns the first item stored in the Queue
-template<typename ElemType>
-ElemType Queue<ElemType>::front()
+template<typename ElemType, typename StatsPolicy>
+ElemType Queue<ElemType, StatsPolicy>::front()
 {
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
         if (num_items < 1)
         {
                 throw runtime_error("Cannot get first of "
                                         "empty Queue");
         }
-        return array[0];
+        return array[head];
 }
 
 //back function
 //Parameters: Nothing
 //Returns: ElemType
 //Does: Returns the last item stored in the Queue
-template<typename ElemType>
-ElemType Queue<ElemType>::back()
+template<typename ElemType, typename StatsPolicy>
+ElemType Queue<ElemType, StatsPolicy>::back()
 {
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
         if (num_items < 1)
         {
                 throw runtime_error("Cannot get last of " 
                                         "empty Queue");
         }
-        return array[num_items-1];
+        return array[(head + num_items - 1) % max_capacity];
 }
 
 //push function
 //Parameters: ElemType element, item being added to the Queue
 //Returns: Nothing
 //Does: Adds an element to the back of the Queue
-template<typename ElemType>
-void Queue<ElemType>::push(ElemType element)
+template<typename ElemType, typename StatsPolicy>
+void Queue<ElemType, StatsPolicy>::push(ElemType element)
 {
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
         ensure_capacity(num_items+1);
-        array[num_items] = element;
+        array[(head + num_items) % max_capacity] = element;
         num_items++;
 }
 
 //pop function
 //Parameters: Nothing
 //Returns: Nothing
-//Does: Removes the first item in the Queue
-template<typename ElemType>
-void Queue<ElemType>::pop()
+//Does: Removes the first item in the Queue by advancing the head
+//      of the circular array
+template<typename ElemType, typename StatsPolicy>
+void Queue<ElemType, StatsPolicy>::pop()
+{
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
+        if (num_items < 1)
+        {
+                throw runtime_error("Cannot pop from " 
+                                        "empty Queue");
+        }
+        head = (head + 1) % max_capacity;
+        num_items--;
+}
+
+//pop_back function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Removes the last item in the Queue
+template<typename ElemType, typename StatsPolicy>
+void Queue<ElemType, StatsPolicy>::pop_back()
 {
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
         if (num_items < 1)
         {
                 throw runtime_error("Cannot pop from " 
                                         "empty Queue");
         }
-        shift_left(0,num_items-1);
         num_items--;
 }
 
 //ensure_capacity function
 //Parameters: int desired_capacity, amount of memory needed
 //Returns: Nothing
-//Does: Checks if Queue has the desired memory allocation
-template<typename ElemType>
-void Queue<ElemType>::ensure_capacity(int desired_capacity)
+//Does: Checks if Queue has the desired memory allocation, doubling
+//      the array when it does not
+template<typename ElemType, typename StatsPolicy>
+void Queue<ElemType, StatsPolicy>::ensure_capacity(int desired_capacity)
 {
-        if (num_items > desired_capacity)
+        if (desired_capacity <= max_capacity)
         {
                 return;
         }
+        if (desired_capacity < 2 * max_capacity)
+        {
+                desired_capacity = 2 * max_capacity;
+        }
+        StatsPolicy::reallocation();
         ElemType *new_array = NULL;
         new_array = new ElemType[desired_capacity];
+        copy_array(array, head, max_capacity, new_array, num_items);
         max_capacity = desired_capacity;
-        for (int i = 0; i < num_items; i++)
-        {
-                new_array[i] = array[i];
-        }
         delete [] array;
         array = new_array;
+        head = 0;
 }
 
 //copy_array function
-//Parameters: ElemType from[], array that is being copied from
+//Parameters: ElemType from[], circular array that is being copied from
+//            int from_head, index of the first element in from
+//            int from_capacity, the length of from
 //            ElemType to[], array being copied into
-//            int length, the length of the array 
+//            int length, the number of elements copied
 //Returns: Nothing
-//Does: Copies the contents of an array from one to another
-template<typename ElemType>
-void Queue<ElemType>::copy_array(ElemType from[], 
-                                        ElemType to[], int length)
+//Does: Copies the elements of a circular array, in order, to the start
+//      of another array
+template<typename ElemType, typename StatsPolicy>
+void Queue<ElemType, StatsPolicy>::copy_array(ElemType from[], int from_head,
+                        int from_capacity, ElemType to[], int length)
 {
         for (int i = 0; i < length; ++i)
-                to[i] = from[i];
+                to[i] = from[(from_head + i) % from_capacity];
 }
 
-//shift_left function
-//Parameters: int begin, index of the beginning of the shift
-//            int end, index of the end of the shift
-//Returns: Nothing
-//Does: Shifts elements to the left within the bounds 
-//      passed into the function
-template<typename ElemType>
-void Queue<ElemType>::shift_left(int begin, int end)
+//stats function
+//Parameters: Nothing
+//Returns: StatsSnapshot - copy of the counters kept by the StatsPolicy
+//Does: Reports reallocations and per operation latencies (all zero
+//      unless the Queue is built with OpStats)
+template<typename ElemType, typename StatsPolicy>
+StatsSnapshot Queue<ElemType, StatsPolicy>::stats()
 {
-        for (int i = begin; i < end; i++)
-        {
-                array[i] = array[i+1];
-        }
-}
\ No newline at end of file
+        return StatsPolicy::snapshot();
+}
+
+#endif
\ No newline at end of file
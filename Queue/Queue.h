@@ -12,8 +12,10 @@
 #ifndef QUEUE_H_
 #define QUEUE_H_
 
-template<typename ElemType>
-class Queue
+#include "../Instrumentation/OpStats.h"
+
+template<typename ElemType, typename StatsPolicy = NoStats>
+class Queue : private StatsPolicy
 {
         public:
                 //default constructor
@@ -36,21 +38,26 @@ class Queue
                 void push(ElemType element);
                 //removes first element from the Queue
                 void pop();
+                //removes last element from the Queue
+                void pop_back();
+                //returns a snapshot of the operation counters
+                StatsSnapshot stats();
 
         private:
 
-                //array storing data
+                //circular array storing data
                 ElemType *array;
+                //index of the first element in array
+                int head;
                 //number of items currently stored
                 int num_items;
                 //maximum number of elements 
                 int max_capacity;
                 //verify memory is correctly allocated
                 void ensure_capacity(int desired_capacity);
-                //copies one array into another
-                void copy_array(ElemType from[], ElemType to[], int length);
-                //shifts all elements to the left from one index to another
-                void shift_left(int begin, int end);
+                //copies the elements of a circular array into a flat one
+                void copy_array(ElemType from[], int from_head,
+                                int from_capacity, ElemType to[], int length);
 
 };
 
@@ -0,0 +1,391 @@
+/*
+ *
+ * Spill Queue Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * SpillQueue.cpp
+ * Full function implementation
+ *
+ */
+
+#include "SpillQueue.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+//default constructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Initializes an empty queue that spills 65536 element segments to
+//      the system temp directory
+template<typename ElemType, typename StatsPolicy>
+SpillQueue<ElemType, StatsPolicy>::SpillQueue()
+{
+        init_queue(filesystem::temp_directory_path().string(), 65536);
+}
+
+//spill directory constructor
+//Parameters: const std::string &spill_dir, existing directory the
+//            segment files are written to
+//            int segment_size, number of elements per segment
+//Returns: Nothing
+//Does: Initializes an empty queue, at most three segments of which are
+//      held in memory
+template<typename ElemType, typename StatsPolicy>
+SpillQueue<ElemType, StatsPolicy>::SpillQueue(const string &spill_dir, int segment_size)
+{
+        init_queue(spill_dir, segment_size);
+}
+
+//destructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Waits for any read ahead, deletes the buffers and removes the
+//      segment files still on disk
+template<typename ElemType, typename StatsPolicy>
+SpillQueue<ElemType, StatsPolicy>::~SpillQueue()
+{
+        if (pending_read.valid())
+        {
+                try
+                {
+                        pending_read.get();
+                }
+                catch (...)
+                {
+                }
+        }
+        if (ahead_segment >= 0)
+        {
+                remove(segment_path(ahead_segment).c_str());
+        }
+        for (long long segment = first_spilled; segment < next_spill; segment++)
+        {
+                remove(segment_path(segment).c_str());
+        }
+        delete [] head;
+        delete [] ahead;
+        delete [] tail;
+}
+
+//is_empty function
+//Parameters: Nothing
+//Returns: bool
+//Does: Checks if a queue is empty
+template<typename ElemType, typename StatsPolicy>
+bool SpillQueue<ElemType, StatsPolicy>::is_empty()
+{
+        return num_items == 0;
+}
+
+//size function
+//Parameters: Nothing
+//Returns: long long
+//Does: Returns the number of items stored in the Queue, on disk or not
+template<typename ElemType, typename StatsPolicy>
+long long SpillQueue<ElemType, StatsPolicy>::size()
+{
+        return num_items;
+}
+
+//front function
+//Parameters: Nothing
+//Returns: ElemType
+//Does: Returns the first item stored in the Queue, which is always in
+//      the head segment
+template<typename ElemType, typename StatsPolicy>
+ElemType SpillQueue<ElemType, StatsPolicy>::front()
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        if (num_items < 1)
+        {
+                throw runtime_error("Cannot get first of "
+                                        "empty Queue");
+        }
+        return head[head_pos];
+}
+
+//back function
+//Parameters: Nothing
+//Returns: ElemType
+//Does: Returns the last item stored in the Queue
+template<typename ElemType, typename StatsPolicy>
+ElemType SpillQueue<ElemType, StatsPolicy>::back()
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        if (num_items < 1)
+        {
+                throw runtime_error("Cannot get last of "
+                                        "empty Queue");
+        }
+        return last;
+}
+
+//push function
+//Parameters: ElemType element, item being added to the Queue
+//Returns: Nothing
+//Does: Adds an element to the back of the Queue. While nothing is
+//      queued after the head segment the element goes straight into it;
+//      otherwise it goes into the tail segment. A full tail is handed
+//      to the read ahead slot or written to disk before the element is
+//      added, so a failed write leaves the queue as it was
+template<typename ElemType, typename StatsPolicy>
+void SpillQueue<ElemType, StatsPolicy>::push(ElemType element)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
+        if (head_len < segment_size and ahead_len == 0 and tail_len == 0)
+        {
+                head[head_len] = element;
+                head_len++;
+        }
+        else
+        {
+                if (tail_len == segment_size)
+                {
+                        if (ahead_len == 0)
+                        {
+                                swap(ahead, tail);
+                                ahead_len = tail_len;
+                        }
+                        else
+                        {
+                                spill_tail();
+                        }
+                        tail_len = 0;
+                }
+                tail[tail_len] = element;
+                tail_len++;
+        }
+        last = element;
+        num_items++;
+}
+
+//pop function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Removes the first item in the Queue, moving the next segment into
+//      head when head is used up. When that segment is still being read
+//      back, the read is finished first, so if it fails the exception
+//      leaves the queue unchanged and the pop can be retried
+template<typename ElemType, typename StatsPolicy>
+void SpillQueue<ElemType, StatsPolicy>::pop()
+{
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
+        if (num_items < 1)
+        {
+                throw runtime_error("Cannot pop from "
+                                        "empty Queue");
+        }
+        if (head_pos + 1 == head_len)
+        {
+                finish_read_ahead();
+        }
+        head_pos++;
+        num_items--;
+        if (head_pos == head_len)
+        {
+                refill_head();
+        }
+}
+
+//spilled_segments function
+//Parameters: Nothing
+//Returns: long long - the number of segment files on disk
+//Does: Reports how much of the backlog is currently spilled, counting a
+//      segment being read back until the read has been waited for
+template<typename ElemType, typename StatsPolicy>
+long long SpillQueue<ElemType, StatsPolicy>::spilled_segments()
+{
+        return next_spill - first_spilled + (ahead_segment >= 0);
+}
+
+//stats function
+//Parameters: Nothing
+//Returns: StatsSnapshot - copy of the counters kept by the StatsPolicy
+//Does: Reports segment writes (as reallocations) and per operation
+//      latencies (all zero unless the Queue is built with OpStats)
+template<typename ElemType, typename StatsPolicy>
+StatsSnapshot SpillQueue<ElemType, StatsPolicy>::stats()
+{
+        return StatsPolicy::snapshot();
+}
+
+//init_queue function (private)
+//Parameters: const std::string &dir, the spill directory
+//            int size, number of elements per segment
+//Returns: Nothing
+//Does: Allocates the three in memory segments and picks the file tag
+template<typename ElemType, typename StatsPolicy>
+void SpillQueue<ElemType, StatsPolicy>::init_queue(const string &dir, int size)
+{
+        if (size < 1)
+        {
+                throw runtime_error("SpillQueue segment size "
+                                        "must be positive");
+        }
+        spill_dir = dir;
+        segment_size = size;
+        random_device random;
+        ostringstream tag;
+        tag << hex << random() << random();
+        file_tag = tag.str();
+        head = new ElemType[segment_size];
+        ahead = new ElemType[segment_size];
+        tail = new ElemType[segment_size];
+        head_pos = head_len = ahead_len = tail_len = 0;
+        first_spilled = next_spill = 0;
+        ahead_segment = -1;
+        num_items = 0;
+}
+
+//segment_path function (private)
+//Parameters: long long segment, number of a segment
+//Returns: std::string, the path of the segment's file
+//Does: Builds the file name from the queue's tag and the segment number
+template<typename ElemType, typename StatsPolicy>
+string SpillQueue<ElemType, StatsPolicy>::segment_path(long long segment)
+{
+        return spill_dir + "/spillqueue_" + file_tag + "_" +
+               to_string(segment) + ".seg";
+}
+
+//spill_tail function (private)
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Writes the full tail segment to a new file in one sequential
+//      write, throwing if the write does not complete
+template<typename ElemType, typename StatsPolicy>
+void SpillQueue<ElemType, StatsPolicy>::spill_tail()
+{
+        StatsPolicy::reallocation();
+        string path = segment_path(next_spill);
+        FILE *file = fopen(path.c_str(), "wb");
+        if (file == nullptr)
+        {
+                throw runtime_error("SpillQueue could not create "
+                                        "segment file " + path);
+        }
+        size_t written = fwrite(tail, sizeof(ElemType), segment_size, file);
+        if (fclose(file) != 0 or written != (size_t)segment_size)
+        {
+                remove(path.c_str());
+                throw runtime_error("SpillQueue could not write "
+                                        "segment file " + path);
+        }
+        next_spill++;
+}
+
+//start_read_ahead function (private)
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Claims the oldest segment file and reads it into ahead on a
+//      background thread. ahead is not touched again until the read is
+//      waited for in finish_read_ahead
+template<typename ElemType, typename StatsPolicy>
+void SpillQueue<ElemType, StatsPolicy>::start_read_ahead()
+{
+        launch_read(first_spilled);
+        ahead_segment = first_spilled;
+        ahead_len = segment_size;
+        first_spilled++;
+}
+
+//launch_read function (private)
+//Parameters: long long segment, number of the segment being read
+//Returns: Nothing
+//Does: Starts the background read of a segment file into ahead
+template<typename ElemType, typename StatsPolicy>
+void SpillQueue<ElemType, StatsPolicy>::launch_read(long long segment)
+{
+        ElemType *into = ahead;
+        pending_read = async(launch::async, [this, segment, into]()
+        {
+                read_segment(segment, into);
+        });
+}
+
+//finish_read_ahead function (private)
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Waits for the read of the claimed segment into ahead, if there is
+//      one. If the read failed the error is rethrown with nothing else
+//      changed and the segment stays claimed, so the next call starts
+//      the read again
+template<typename ElemType, typename StatsPolicy>
+void SpillQueue<ElemType, StatsPolicy>::finish_read_ahead()
+{
+        if (ahead_segment < 0)
+        {
+                return;
+        }
+        if (!pending_read.valid())
+        {
+                launch_read(ahead_segment);
+        }
+        pending_read.get();
+        ahead_segment = -1;
+}
+
+//read_segment function (private)
+//Parameters: long long segment, number of the segment being read
+//            ElemType *into, buffer of segment_size elements
+//Returns: Nothing
+//Does: Reads a whole segment file in one sequential read and deletes it
+//      once the read is complete; a short read keeps the file. Runs on
+//      the read ahead thread, so it only reads members that never change
+//      after construction
+template<typename ElemType, typename StatsPolicy>
+void SpillQueue<ElemType, StatsPolicy>::read_segment(long long segment, ElemType *into)
+{
+        string path = segment_path(segment);
+        FILE *file = fopen(path.c_str(), "rb");
+        if (file == nullptr)
+        {
+                throw runtime_error("SpillQueue could not open "
+                                        "segment file " + path);
+        }
+        size_t read = fread(into, sizeof(ElemType), segment_size, file);
+        fclose(file);
+        if (read != (size_t)segment_size)
+        {
+                throw runtime_error("SpillQueue segment file "
+                                        "is truncated: " + path);
+        }
+        remove(path.c_str());
+}
+
+//refill_head function (private)
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Called once head is used up, after pop has finished any read
+//      into ahead. The read ahead segment is next in line if there is
+//      one, and the read of the following file is started straight
+//      away. Otherwise the partly filled tail becomes the head
+template<typename ElemType, typename StatsPolicy>
+void SpillQueue<ElemType, StatsPolicy>::refill_head()
+{
+        head_pos = head_len = 0;
+        if (ahead_len > 0)
+        {
+                swap(head, ahead);
+                head_len = ahead_len;
+                ahead_len = 0;
+                if (first_spilled < next_spill)
+                {
+                        start_read_ahead();
+                }
+        }
+        else if (tail_len > 0)
+        {
+                swap(head, tail);
+                head_len = tail_len;
+                tail_len = 0;
+        }
+}
\ No newline at end of file
@@ -0,0 +1,124 @@
+/*
+ *
+ * Spill Queue Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * SpillQueue.h
+ * Header and function declarations
+ *
+ * Queue for trivially copyable elements whose memory use stays bounded
+ * however long the backlog gets. Elements are kept in segments of
+ * segment_size elements. Only three segments are ever in memory: the
+ * head segment being popped from, the tail segment being pushed to and
+ * one segment of read ahead. When the tail fills while older segments
+ * are still waiting, it is written whole to its own file in the spill
+ * directory, one sequential write per segment. While the consumer works
+ * through the head segment, the oldest file is read into the read ahead
+ * segment on a background thread and then deleted, so pops rarely wait
+ * on the disk. A backlog that fits in those three segments never touches
+ * the disk at all.
+ *
+ */
+
+#ifndef SPILLQUEUE_H_
+#define SPILLQUEUE_H_
+
+#include "../Instrumentation/OpStats.h"
+
+#include <future>
+#include <string>
+#include <type_traits>
+
+template<typename ElemType, typename StatsPolicy = NoStats>
+class SpillQueue : private StatsPolicy
+{
+        public:
+                //default constructor, spills to the system temp directory
+                SpillQueue();
+                //spills to the given directory in segments of the given
+                //number of elements
+                SpillQueue(const std::string &spill_dir, int segment_size = 65536);
+                //destructor
+                ~SpillQueue();
+                //the spilled segments are files owned by one queue, so it
+                //cannot be copied
+                SpillQueue(const SpillQueue &rhs) = delete;
+                SpillQueue &operator=(const SpillQueue &rhs) = delete;
+                //checks if Queue is empty
+                bool is_empty();
+                //returns the number of items in the Queue
+                long long size();
+                //returns first element in the Queue
+                ElemType front();
+                //returns last element in the Queue
+                ElemType back();
+                //adds an element to the end of the Queue
+                void push(ElemType element);
+                //removes first element from the Queue
+                void pop();
+                //returns the number of segments currently on disk
+                long long spilled_segments();
+                //returns a snapshot of the operation counters
+                StatsSnapshot stats();
+
+        private:
+
+                static_assert(std::is_trivially_copyable<ElemType>::value,
+                              "SpillQueue elements are written to disk as "
+                              "raw bytes and must be trivially copyable");
+
+                //directory the segment files are written to
+                std::string spill_dir;
+                //random tag in the file names, so queues sharing a
+                //directory do not collide
+                std::string file_tag;
+                //number of elements in a segment
+                int segment_size;
+                //segment being popped from, holding head[head_pos] through
+                //head[head_len-1]
+                ElemType *head;
+                int head_pos;
+                int head_len;
+                //the segment after head, either filled from the tail
+                //directly or read back from disk by pending_read
+                ElemType *ahead;
+                //number of elements in (or being read into) ahead
+                int ahead_len;
+                //background read filling ahead, valid while one runs
+                std::future<void> pending_read;
+                //segment file claimed for ahead whose read has not been
+                //waited for yet, -1 when ahead holds its elements
+                long long ahead_segment;
+                //segment being pushed to, holding tail[0] through
+                //tail[tail_len-1]
+                ElemType *tail;
+                int tail_len;
+                //segments on disk are numbered first_spilled up to but
+                //not including next_spill, oldest first
+                long long first_spilled;
+                long long next_spill;
+                //number of items in the queue
+                long long num_items;
+                //copy of the newest element, it may already be on disk
+                ElemType last;
+
+                //sets up an empty queue
+                void init_queue(const std::string &dir, int size);
+                //returns the path of a segment file
+                std::string segment_path(long long segment);
+                //writes the full tail segment to the next segment file
+                void spill_tail();
+                //starts reading the oldest segment file into ahead
+                void start_read_ahead();
+                //starts the background read of a segment into ahead
+                void launch_read(long long segment);
+                //waits for the read into ahead, rethrowing its error
+                void finish_read_ahead();
+                //reads a segment file into a buffer and deletes the file
+                void read_segment(long long segment, ElemType *into);
+                //moves the next segment into head once head is used up
+                void refill_head();
+};
+
+#endif
\ No newline at end of file
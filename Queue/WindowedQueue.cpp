@@ -0,0 +1,269 @@
+/*
+ *
+ * Windowed Queue Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * WindowedQueue.cpp
+ * Full function implementation
+ *
+ */
+
+#include "WindowedQueue.h"
+#include "Queue.cpp"
+
+using namespace std;
+
+//default constructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Initializes an empty window whose samples only leave through pop
+//      or expire_before
+template<typename ElemType, typename StatsPolicy>
+WindowedQueue<ElemType, StatsPolicy>::WindowedQueue()
+{
+        back_total = ElemType();
+        next_seq = 0;
+        max_age = -1;
+        last_timestamp = 0;
+}
+
+//max age constructor
+//Parameters: long long max_age - the oldest a sample may be, in the same
+//            unit as the timestamps passed to push
+//Returns: Nothing
+//Does: Initializes an empty window that drops samples older than max_age
+//      whenever a newer timestamped sample is pushed
+template<typename ElemType, typename StatsPolicy>
+WindowedQueue<ElemType, StatsPolicy>::WindowedQueue(long long max_age)
+{
+        back_total = ElemType();
+        next_seq = 0;
+        this->max_age = max_age;
+        last_timestamp = 0;
+}
+
+//is_empty function
+//Parameters: Nothing
+//Returns: bool
+//Does: Checks if the window is empty
+template<typename ElemType, typename StatsPolicy>
+bool WindowedQueue<ElemType, StatsPolicy>::is_empty()
+{
+        return samples.is_empty();
+}
+
+//size function
+//Parameters: Nothing
+//Returns: int
+//Does: Returns the number of samples in the window
+template<typename ElemType, typename StatsPolicy>
+int WindowedQueue<ElemType, StatsPolicy>::size()
+{
+        return samples.size();
+}
+
+//front function
+//Parameters: Nothing
+//Returns: ElemType
+//Does: Returns the oldest sample in the window
+template<typename ElemType, typename StatsPolicy>
+ElemType WindowedQueue<ElemType, StatsPolicy>::front()
+{
+        ensure_not_empty();
+        return samples.front().value;
+}
+
+//back function
+//Parameters: Nothing
+//Returns: ElemType
+//Does: Returns the newest sample in the window
+template<typename ElemType, typename StatsPolicy>
+ElemType WindowedQueue<ElemType, StatsPolicy>::back()
+{
+        ensure_not_empty();
+        return samples.back().value;
+}
+
+//push function
+//Parameters: ElemType element, the sample being added
+//Returns: Nothing
+//Does: Adds a sample to the back of the window with the timestamp of the
+//      newest sample so far (0 if there was none), so mixing untimed and
+//      timed pushes never makes an untimed sample look older than it is
+template<typename ElemType, typename StatsPolicy>
+void WindowedQueue<ElemType, StatsPolicy>::push(ElemType element)
+{
+        push(element, last_timestamp);
+}
+
+//push function (timestamped)
+//Parameters: ElemType element, the sample being added
+//            long long timestamp, when the sample was taken
+//Returns: Nothing
+//Does: Expires samples older than max_age (if one was given), then adds
+//      the sample to the back of the window. Candidates in the min and
+//      max queues that the new sample outlives and beats can never be
+//      reported again, so they are dropped from the back
+template<typename ElemType, typename StatsPolicy>
+void WindowedQueue<ElemType, StatsPolicy>::push(ElemType element, long long timestamp)
+{
+        if (max_age >= 0)
+        {
+                expire_before(timestamp - max_age);
+        }
+        Sample sample;
+        sample.value = element;
+        sample.seq = next_seq++;
+        sample.timestamp = timestamp;
+        samples.push(sample);
+        last_timestamp = timestamp;
+        back_values.push_back(element);
+        back_total += element;
+        while (!min_queue.is_empty() and element < min_queue.back().value)
+        {
+                min_queue.pop_back();
+        }
+        min_queue.push(sample);
+        while (!max_queue.is_empty() and max_queue.back().value < element)
+        {
+                max_queue.pop_back();
+        }
+        max_queue.push(sample);
+}
+
+//pop function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Removes the oldest sample, and takes it off the front of the min
+//      and max queues if it was still a candidate there. Its suffix sum
+//      is dropped from the front stack, refilling the stack first if the
+//      oldest sample is still on the back one
+template<typename ElemType, typename StatsPolicy>
+void WindowedQueue<ElemType, StatsPolicy>::pop()
+{
+        ensure_not_empty();
+        Sample oldest = samples.front();
+        samples.pop();
+        if (front_sums.empty())
+        {
+                refill_front();
+        }
+        front_sums.pop_back();
+        if (min_queue.front().seq == oldest.seq)
+        {
+                min_queue.pop();
+        }
+        if (max_queue.front().seq == oldest.seq)
+        {
+                max_queue.pop();
+        }
+}
+
+//expire_before function
+//Parameters: long long timestamp, the oldest time kept in the window
+//Returns: int - the number of samples removed
+//Does: Pops samples from the front while they were taken before the
+//      given time
+template<typename ElemType, typename StatsPolicy>
+int WindowedQueue<ElemType, StatsPolicy>::expire_before(long long timestamp)
+{
+        int expired = 0;
+        while (!samples.is_empty() and samples.front().timestamp < timestamp)
+        {
+                pop();
+                expired++;
+        }
+        return expired;
+}
+
+//min function
+//Parameters: Nothing
+//Returns: ElemType - the smallest sample in the window
+//Does: Returns the front of the min queue
+template<typename ElemType, typename StatsPolicy>
+ElemType WindowedQueue<ElemType, StatsPolicy>::min()
+{
+        ensure_not_empty();
+        return min_queue.front().value;
+}
+
+//max function
+//Parameters: Nothing
+//Returns: ElemType - the largest sample in the window
+//Does: Returns the front of the max queue
+template<typename ElemType, typename StatsPolicy>
+ElemType WindowedQueue<ElemType, StatsPolicy>::max()
+{
+        ensure_not_empty();
+        return max_queue.front().value;
+}
+
+//sum function
+//Parameters: Nothing
+//Returns: ElemType - the sum of the samples in the window
+//Does: Adds the sum of the front stack to the sum of the back one
+template<typename ElemType, typename StatsPolicy>
+ElemType WindowedQueue<ElemType, StatsPolicy>::sum()
+{
+        if (front_sums.empty())
+        {
+                return back_total;
+        }
+        return front_sums.back() + back_total;
+}
+
+//mean function
+//Parameters: Nothing
+//Returns: double - the average of the samples in the window
+//Does: Divides the sum by the number of samples
+template<typename ElemType, typename StatsPolicy>
+double WindowedQueue<ElemType, StatsPolicy>::mean()
+{
+        ensure_not_empty();
+        return static_cast<double>(sum()) / samples.size();
+}
+
+//stats function
+//Parameters: Nothing
+//Returns: StatsSnapshot - copy of the counters kept for the samples
+//Does: Reports reallocations and per operation latencies of the sample
+//      queue (all zero unless the window is built with OpStats)
+template<typename ElemType, typename StatsPolicy>
+StatsSnapshot WindowedQueue<ElemType, StatsPolicy>::stats()
+{
+        return samples.stats();
+}
+
+//ensure_not_empty function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Throws if there are no samples in the window
+template<typename ElemType, typename StatsPolicy>
+void WindowedQueue<ElemType, StatsPolicy>::ensure_not_empty()
+{
+        if (samples.is_empty())
+        {
+                throw runtime_error("Window is empty");
+        }
+}
+
+//refill_front function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Pushes the back samples onto the front stack newest first, each
+//      with the sum of itself and every newer one, so the oldest ends on
+//      top holding the sum of them all. Every sample is moved once, so
+//      pop stays O(1) amortized
+template<typename ElemType, typename StatsPolicy>
+void WindowedQueue<ElemType, StatsPolicy>::refill_front()
+{
+        ElemType running = ElemType();
+        for (int i = back_values.size() - 1; i >= 0; i--)
+        {
+                running = back_values[i] + running;
+                front_sums.push_back(running);
+        }
+        back_values.clear();
+        back_total = ElemType();
+}
\ No newline at end of file
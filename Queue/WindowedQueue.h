@@ -0,0 +1,101 @@
+/*
+ *
+ * Windowed Queue Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * WindowedQueue.h
+ * Header and function declarations
+ *
+ * Queue of samples that keeps the min, max, sum and mean of the samples
+ * currently in it. The sum is kept with two stacks so it is never
+ * subtracted from, which would let floating point samples drift: new
+ * samples are added to back_total, and when the front stack runs out the
+ * back samples are moved onto it as suffix sums, newest first, so the top
+ * is always the sum of the older part of the window. The min and max
+ * come from two monotonic queues: min_queue keeps the samples that
+ * could still become the minimum, in increasing order, and max_queue does
+ * the same for the maximum. Each sample enters and leaves each of them at
+ * most once, so every operation is O(1) amortized regardless of the
+ * window size. Samples can carry a timestamp, and with a max_age the
+ * front is expired automatically as newer samples arrive.
+ *
+ */
+
+#ifndef WINDOWEDQUEUE_H_
+#define WINDOWEDQUEUE_H_
+
+#include <vector>
+#include "Queue.h"
+
+template<typename ElemType, typename StatsPolicy = NoStats>
+class WindowedQueue
+{
+        public:
+                //default constructor, samples never expire on their own
+                WindowedQueue();
+                //samples older than max_age are expired on every push
+                WindowedQueue(long long max_age);
+                //checks if the window is empty
+                bool is_empty();
+                //returns the number of samples in the window
+                int size();
+                //returns the oldest sample in the window
+                ElemType front();
+                //returns the newest sample in the window
+                ElemType back();
+                //adds a sample stamped with the newest timestamp so far
+                void push(ElemType element);
+                //adds a sample taken at the given time to the window
+                void push(ElemType element, long long timestamp);
+                //removes the oldest sample from the window
+                void pop();
+                //removes every sample taken before the given time
+                int expire_before(long long timestamp);
+                //returns the smallest sample in the window
+                ElemType min();
+                //returns the largest sample in the window
+                ElemType max();
+                //returns the sum of the samples in the window
+                ElemType sum();
+                //returns the average of the samples in the window
+                double mean();
+                //returns a snapshot of the operation counters
+                StatsSnapshot stats();
+
+        private:
+
+                //a sample with its position in the stream and its time
+                struct Sample
+                {
+                        ElemType value;
+                        long long seq;
+                        long long timestamp;
+                };
+
+                //every sample in the window, oldest first
+                Queue<Sample, StatsPolicy> samples;
+                //candidates for the minimum, increasing values
+                Queue<Sample> min_queue;
+                //candidates for the maximum, decreasing values
+                Queue<Sample> max_queue;
+                //suffix sums of the older samples, the top covers all of them
+                std::vector<ElemType> front_sums;
+                //samples pushed since the front stack was last refilled
+                std::vector<ElemType> back_values;
+                //sum of back_values
+                ElemType back_total;
+                //sequence number given to the next sample pushed
+                long long next_seq;
+                //age at which samples expire, negative for never
+                long long max_age;
+                //timestamp of the newest sample, reused by untimed pushes
+                long long last_timestamp;
+
+                //throws if the window is empty
+                void ensure_not_empty();
+                //moves the back samples onto the front stack as suffix sums
+                void refill_front();
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,176 @@
+/*
+ *
+ * Interval Tree Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * IntervalTree.cpp
+ * Full function declaration
+ *
+ */
+
+#include "IntervalTree.h"
+#include "RBT.cpp"
+#include <stdexcept>
+
+using namespace std;
+
+//default constructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Initializes an empty instance of the Class
+template<typename T, typename StatsPolicy>
+IntervalTree<T, StatsPolicy>::IntervalTree()
+{
+        num_intervals = 0;
+}
+
+//insert function
+//Parameters: const T &low, const T &high - endpoints of the interval
+//Returns: Nothing
+//Does: Inserts the closed interval [low, high], duplicates are counted
+template<typename T, typename StatsPolicy>
+void IntervalTree<T, StatsPolicy>::insert(const T &low, const T &high)
+{
+        if (high < low)
+        {
+                throw runtime_error("Interval ends before it starts");
+        }
+        Tree::insert(make_entry(low, high));
+        num_intervals++;
+}
+
+//remove function
+//Parameters: const T &low, const T &high - endpoints of the interval
+//Returns: Nothing
+//Does: Removes one copy of the interval [low, high] if it is stored
+template<typename T, typename StatsPolicy>
+void IntervalTree<T, StatsPolicy>::remove(const T &low, const T &high)
+{
+        IntervalEntry<T> entry = make_entry(low, high);
+        if (Tree::find_node(entry) == nullptr)
+        {
+                return;
+        }
+        Tree::remove(entry);
+        num_intervals--;
+}
+
+//contains function
+//Parameters: const T &low, const T &high - endpoints of the interval
+//Returns: bool - whether or not the interval is stored
+//Does: Checks if the exact interval [low, high] is stored
+template<typename T, typename StatsPolicy>
+bool IntervalTree<T, StatsPolicy>::contains(const T &low, const T &high)
+{
+        return Tree::contains(make_entry(low, high));
+}
+
+//for_each_overlap function
+//Parameters: const T &low, const T &high - endpoints of the query
+//            Visit visit - called with each overlapping Interval<T>
+//Returns: int - the number of intervals visited
+//Does: Visits, in order, every stored interval that shares at least one
+//      point with [low, high]. Subtrees whose max endpoint is below low,
+//      and right subtrees of nodes starting after high, are skipped
+template<typename T, typename StatsPolicy>
+template<typename Visit>
+int IntervalTree<T, StatsPolicy>::for_each_overlap(const T &low, const T &high,
+                                                Visit visit)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        return overlap_recur(Tree::root, low, high, visit);
+}
+
+//overlapping function
+//Parameters: const T &low, const T &high - endpoints of the query
+//Returns: vector<Interval<T>> - the overlapping intervals, in order
+//Does: Collects every stored interval that overlaps [low, high]
+template<typename T, typename StatsPolicy>
+vector<Interval<T> > IntervalTree<T, StatsPolicy>::overlapping(const T &low,
+                                                        const T &high)
+{
+        vector<Interval<T> > result;
+        for_each_overlap(low, high, [&result](const Interval<T> &interval) {
+                result.push_back(interval);
+        });
+        return result;
+}
+
+//stabbing function
+//Parameters: const T &point - the point being queried
+//Returns: vector<Interval<T>> - the intervals containing the point
+//Does: Collects every stored interval with low <= point <= high
+template<typename T, typename StatsPolicy>
+vector<Interval<T> > IntervalTree<T, StatsPolicy>::stabbing(const T &point)
+{
+        return overlapping(point, point);
+}
+
+//size function
+//Parameters: Nothing
+//Returns: int - the number of intervals stored
+//Does: Returns the number of intervals stored, counting duplicates
+template<typename T, typename StatsPolicy>
+int IntervalTree<T, StatsPolicy>::size()
+{
+        return num_intervals;
+}
+
+//stats function
+//Parameters: Nothing
+//Returns: StatsSnapshot - copy of the counters kept by the StatsPolicy
+//Does: Reports comparisons, rotations, node visits and per operation
+//      latencies (all zero unless the tree is built with OpStats)
+template<typename T, typename StatsPolicy>
+StatsSnapshot IntervalTree<T, StatsPolicy>::stats()
+{
+        return Tree::stats();
+}
+
+//make_entry function
+//Parameters: const T &low, const T &high - endpoints of the interval
+//Returns: IntervalEntry<T> - the element stored for the interval
+//Does: Builds a tree element whose max endpoint is its own high
+template<typename T, typename StatsPolicy>
+IntervalEntry<T> IntervalTree<T, StatsPolicy>::make_entry(const T &low,
+                                                        const T &high)
+{
+        IntervalEntry<T> entry;
+        entry.interval.low = low;
+        entry.interval.high = high;
+        entry.max_high = high;
+        return entry;
+}
+
+//overlap_recur function
+//Parameters: Node *node - the root of the subtree being searched
+//            const T &low, const T &high - endpoints of the query
+//            Visit &visit - called with each overlapping interval
+//Returns: int - the number of intervals visited in the subtree
+//Does: In order walk that prunes subtrees which cannot overlap
+template<typename T, typename StatsPolicy>
+template<typename Visit>
+int IntervalTree<T, StatsPolicy>::overlap_recur(Node *node, const T &low,
+                                                const T &high, Visit &visit)
+{
+        if (node == nullptr or node->data.max_high < low)
+        {
+                return 0;
+        }
+        StatsPolicy::node_visit();
+        int visited = overlap_recur(node->left, low, high, visit);
+        if (high < node->data.interval.low)
+        {
+                return visited;
+        }
+        if (!(node->data.interval.high < low))
+        {
+                for (int i = 0; i < node->count; i++)
+                {
+                        visit(node->data.interval);
+                        visited++;
+                }
+        }
+        return visited + overlap_recur(node->right, low, high, visit);
+}
\ No newline at end of file
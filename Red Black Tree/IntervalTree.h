@@ -0,0 +1,130 @@
+/*
+ *
+ * Interval Tree Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * IntervalTree.h
+ * Class Header and Declaration
+ *
+ * Closed intervals [low, high] kept in an RBT ordered by (low, high).
+ * Every node also stores the largest high endpoint in its subtree. The
+ * RBT keeps that value current through its rotations and insert/delete
+ * fixups (see RBTAugment), so overlap and stabbing queries can skip any
+ * subtree whose max endpoint ends before the query starts.
+ *
+ */
+
+#ifndef INTERVALTREE_H_
+#define INTERVALTREE_H_
+
+#include "RBT.h"
+#include <vector>
+
+//closed interval [low, high]
+template<typename T>
+struct Interval
+{
+        T low;
+        T high;
+};
+
+//element stored in the tree, an interval plus its subtree max endpoint
+template<typename T>
+struct IntervalEntry
+{
+        Interval<T> interval;
+        T max_high;
+};
+
+//orders entries by low endpoint, then by high endpoint
+struct IntervalCompare
+{
+        template<typename T>
+        int operator()(const IntervalEntry<T> &a,
+                       const IntervalEntry<T> &b) const
+        {
+                if (a.interval.low < b.interval.low)
+                {
+                        return -1;
+                }
+                if (b.interval.low < a.interval.low)
+                {
+                        return 1;
+                }
+                if (a.interval.high < b.interval.high)
+                {
+                        return -1;
+                }
+                if (b.interval.high < a.interval.high)
+                {
+                        return 1;
+                }
+                return 0;
+        }
+};
+
+//keeps max_high equal to the largest high endpoint below each node
+template<typename T>
+struct RBTAugment<IntervalEntry<T> >
+{
+        static const bool enabled = true;
+        static void update(IntervalEntry<T> &entry,
+                           const IntervalEntry<T> *left,
+                           const IntervalEntry<T> *right)
+        {
+                entry.max_high = entry.interval.high;
+                if (left != nullptr and entry.max_high < left->max_high)
+                {
+                        entry.max_high = left->max_high;
+                }
+                if (right != nullptr and entry.max_high < right->max_high)
+                {
+                        entry.max_high = right->max_high;
+                }
+        }
+};
+
+template<typename T, typename StatsPolicy = NoStats>
+class IntervalTree : private RBT<IntervalEntry<T>, IntervalCompare,
+                                 StatsPolicy>
+{
+        public:
+                //Constructor
+                IntervalTree();
+                //inserts the interval [low, high]
+                void insert(const T &low, const T &high);
+                //removes one copy of the interval [low, high]
+                void remove(const T &low, const T &high);
+                //checks if the interval [low, high] is stored
+                bool contains(const T &low, const T &high);
+                //calls visit on every interval overlapping [low, high]
+                template<typename Visit>
+                int for_each_overlap(const T &low, const T &high, Visit visit);
+                //returns every interval overlapping [low, high]
+                std::vector<Interval<T> > overlapping(const T &low, const T &high);
+                //returns every interval containing point
+                std::vector<Interval<T> > stabbing(const T &point);
+                //number of intervals stored, counting duplicates
+                int size();
+                //returns a snapshot of the operation counters
+                StatsSnapshot stats();
+        private:
+
+                //the tree the intervals are stored in
+                typedef RBT<IntervalEntry<T>, IntervalCompare,
+                            StatsPolicy> Tree;
+                typedef typename Tree::Node Node;
+
+                //number of intervals stored, counting duplicates
+                int num_intervals;
+
+                //builds the tree element for an interval
+                IntervalEntry<T> make_entry(const T &low, const T &high);
+                //visits the overlapping intervals in a subtree in order
+                template<typename Visit>
+                int overlap_recur(Node *node, const T &low, const T &high,
+                                  Visit &visit);
+};
+
+#endif
\ No newline at end of file
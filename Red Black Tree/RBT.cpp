@@ -9,6 +9,9 @@
  * 
  */
 
+#ifndef RBT_CPP_
+#define RBT_CPP_
+
 #include "RBT.h"
 #include <iostream>
 #include <stack>
@@ -17,22 +20,44 @@
 
 using namespace std;
 
+//hint that a node will be read soon, a no-op on compilers without the
+//builtin
+#ifndef TREE_PREFETCH
+#if defined(__GNUC__) || defined(__clang__)
+#define TREE_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define TREE_PREFETCH(address)
+#endif
+#endif
+
 //default constructor
 //Parameters: Nothing
 //Returns: Nothing
 //Does: Initializes an instance of the Class
-template<typename ElemType>
-RBT<ElemType>::RBT()
+template<typename ElemType, typename Compare, typename StatsPolicy>
+RBT<ElemType, Compare, StatsPolicy>::RBT()
 {
         root = nullptr;
 }
 
+//comparator constructor
+//Parameters: const Compare &comp - the comparator used to order elements
+//Returns: Nothing
+//Does: Initializes an empty instance of the Class that orders its
+//      elements with the passed in comparator
+template<typename ElemType, typename Compare, typename StatsPolicy>
+RBT<ElemType, Compare, StatsPolicy>::RBT(const Compare &comp)
+{
+        root = nullptr;
+        compare = comp;
+}
+
 //destructor
 //Parameters: Nothing
 //Returns: Nothing
 //Does: Deletes all dynamically allocated memory
-template<typename ElemType>
-RBT<ElemType>::~RBT()
+template<typename ElemType, typename Compare, typename StatsPolicy>
+RBT<ElemType, Compare, StatsPolicy>::~RBT()
 {
         delete_tree(root);
 }
@@ -43,25 +68,27 @@ RBT<ElemType>::~RBT()
 //Returns: Nothing
 //Does: Takes in an instance of the RBT class and makes a 
 //      deep copy of the instance 
-template<typename ElemType>
-RBT<ElemType>::RBT(const RBT &rhs)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+RBT<ElemType, Compare, StatsPolicy>::RBT(const RBT &rhs)
 {
+        compare = rhs.compare;
         root = copy_tree(rhs.root);
 }
 
 //assignment operator
 //Parameters: const RBT &rhs, the tree that is being copied 
 //            into the current instance
-//Returns: RBT<ElemType>, the object that copied all data
+//Returns: RBT<ElemType, Compare, StatsPolicy>, the object that copied all data
 //         from the source passed into the function
 //Does: Copes the tree passed into the function into the
 //      current instance of the class
-template<typename ElemType>
-RBT<ElemType> &RBT<ElemType>::operator=(const RBT &rhs)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+RBT<ElemType, Compare, StatsPolicy> &RBT<ElemType, Compare, StatsPolicy>::operator=(const RBT &rhs)
 {
         if (this != &rhs)
         {
                 delete_tree(root);
+                compare = rhs.compare;
                 root = copy_tree(rhs.root);
         }
         return *this;
@@ -73,8 +100,8 @@ RBT<ElemType> &RBT<ElemType>::operator=(const RBT &rhs)
 //Returns: Nothing
 //Does: Using a post-order traversal, deletes all nodes 
 //      stored in the tree
-template<typename ElemType>
-void RBT<ElemType>::delete_tree(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void RBT<ElemType, Compare, StatsPolicy>::delete_tree(Node *node)
 {
         if (node == nullptr)
         {
@@ -92,8 +119,8 @@ void RBT<ElemType>::delete_tree(Node *node)
 //         copied
 //Does: Makes a deep copy of the tree beginning at the passed in
 //      node
-template<typename ElemType>
-typename RBT<ElemType>::Node *RBT<ElemType>::copy_tree(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename RBT<ElemType, Compare, StatsPolicy>::Node *RBT<ElemType, Compare, StatsPolicy>::copy_tree(Node *node)
 {
         if (node != nullptr)
         {
@@ -101,47 +128,93 @@ typename RBT<ElemType>::Node *RBT<ElemType>::copy_tree(Node *node)
                 temp_node = new Node();
                 temp_node->data = node->data;
                 temp_node->count = node->count;
-                temp_node->parent = node->parent;
+                temp_node->set_color(node->color());
+                temp_node->set_parent(nullptr);
                 temp_node->left = copy_tree(node->left);
                 temp_node->right = copy_tree(node->right);
+                if (temp_node->left != nullptr) {
+                        temp_node->left->set_parent(temp_node);
+                }
+                if (temp_node->right != nullptr) {
+                        temp_node->right->set_parent(temp_node);
+                }
+                return temp_node;
         }
-        return node;
+        return nullptr;
 }
 
 //insert function
 //Parameters: ElemType element, element being added to the object
 //Returns: Nothing
 //Does: Inserts an element into the tree
-template<typename ElemType>
-void RBT<ElemType>::insert(ElemType element)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void RBT<ElemType, Compare, StatsPolicy>::insert(ElemType element)
 {       
-        Node *node = new_node(element);
-	Node *temp = nullptr;
-        Node *node_root = this->root;
-        while (node_root != nullptr) {
-                temp = node_root;
-                if (node->data < node_root->data) {
-                        node_root = node_root->left;
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
+        Node *parent;
+        int cmp;
+        Node *node = find_slot(element, parent, cmp);
+        if (node != nullptr) {
+                node->count++;
+                return;
+        }
+        attach_node(new_node(element), parent, cmp);
+}
+
+//find_slot function
+//Parameters: const Key &key - the value being looked for
+//            Node *&parent - set to the last node visited
+//            int &cmp - set to the last comparison against parent
+//Returns: Node - the node storing an equal value, nullptr if none
+//Does: Walks down from the root with one comparison per node. When the
+//      key is missing, parent and cmp describe where it belongs so the
+//      caller can attach a new node without searching again
+template<typename ElemType, typename Compare, typename StatsPolicy>
+template<typename Key>
+typename RBT<ElemType, Compare, StatsPolicy>::Node *RBT<ElemType, Compare, StatsPolicy>::find_slot(const Key &key, Node *&parent, int &cmp)
+{
+        Node *node = root;
+        parent = nullptr;
+        cmp = 0;
+        while (node != nullptr) {
+                StatsPolicy::node_visit();
+                cmp = compare_keys(key, node->data);
+                if (cmp == 0) {
+                        return node;
+                }
+                parent = node;
+                if (cmp < 0) {
+                        node = node->left;
                 } 
                 else {
-                        node_root = node_root->right;
+                        node = node->right;
                 }
         }
-        node->parent = temp;
-        if (temp == nullptr) {
+        return nullptr;
+}
+
+//attach_node function
+//Parameters: Node *node - the new node being linked into the tree
+//            Node *parent, int cmp - the slot reported by find_slot
+//Returns: Nothing
+//Does: Links the node under its parent and restores the RBT invariants
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void RBT<ElemType, Compare, StatsPolicy>::attach_node(Node *node, Node *parent, int cmp)
+{
+        node->set_parent(parent);
+        if (parent == nullptr) {
                 root = node;
-        } else if (node->data < temp->data) {
-                temp->left = node;
-        } else if (node->data > temp->data) {
-                temp->right = node;
+        } else if (cmp < 0) {
+                parent->left = node;
         } else {
-                temp->count++;
+                parent->right = node;
         }
-        if (node->parent == nullptr){
-                node->color = BLACK;
+        augment_path(node);
+        if (node->parent() == nullptr){
+                node->set_color(BLACK);
                 return;
         }
-        if (node->parent->parent == nullptr) {
+        if (node->parent()->parent() == nullptr) {
                 return;
         }
         balance_tree(node);
@@ -152,24 +225,27 @@ void RBT<ElemType>::insert(ElemType element)
 //Returns: Node - the root of the balanced subtree
 //Does: Performs a right rotation of the subtree starting at the passed
 //      in node
-template<typename ElemType>
-void RBT<ElemType>::right_rotate(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void RBT<ElemType, Compare, StatsPolicy>::right_rotate(Node *node)
 {
+        StatsPolicy::rotation();
         Node *left_node = node->left;
         node->left = left_node->right;
         if (left_node->right != nullptr) {
-                left_node->right->parent = node;
+                left_node->right->set_parent(node);
         }
-        left_node->parent = node->parent;
-        if (node->parent == nullptr) {
+        left_node->set_parent(node->parent());
+        if (node->parent() == nullptr) {
                 this->root = left_node;
-        } else if (node == node->parent->right) {
-                node->parent->right = left_node;
+        } else if (node == node->parent()->right) {
+                node->parent()->right = left_node;
         } else {
-                node->parent->left = left_node;
+                node->parent()->left = left_node;
         }
         left_node->right = node;
-        node->parent = left_node;
+        node->set_parent(left_node);
+        augment_node(node);
+        augment_node(left_node);
 }
 
 //left_rotate function
@@ -177,35 +253,39 @@ void RBT<ElemType>::right_rotate(Node *node)
 //Returns: Node - the root of the balanced subtree
 //Does: Performs a right rotation of the subtree starting at the passed
 //      int node
-template<typename ElemType>
-void RBT<ElemType>::left_rotate(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void RBT<ElemType, Compare, StatsPolicy>::left_rotate(Node *node)
 {
+        StatsPolicy::rotation();
         Node *right_node = node->right;
         node->right = right_node->left;
         if (right_node->left != nullptr) {
-                right_node->left->parent = node;
+                right_node->left->set_parent(node);
         }
-        right_node->parent = node->parent;
-        if (node->parent == nullptr) {
+        right_node->set_parent(node->parent());
+        if (node->parent() == nullptr) {
                 this->root = right_node;
-        } else if (node == node->parent->left) {
-                node->parent->left = right_node;
+        } else if (node == node->parent()->left) {
+                node->parent()->left = right_node;
         } else {
-                node->parent->right = right_node;
+                node->parent()->right = right_node;
         }
         right_node->left = node;
-        node->parent = right_node;
+        node->set_parent(right_node);
+        augment_node(node);
+        augment_node(right_node);
 }
 
 //balance_tree function
 //Parameters: Node *node - the root of the RBT subtree
-//Returns: Nothing
+//Returns: bool - true if the fixup reached the root and turned it RED,
+//         so recoloring it BLACK added one to the tree's black height
 //Does: Balances the tree after insertion 
-template<typename ElemType>
-void RBT<ElemType>::balance_tree(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+bool RBT<ElemType, Compare, StatsPolicy>::balance_tree(Node *node)
 {
-        while (node->parent->color == RED) {
-                if (node->parent == node->parent->parent->right) {
+        while (node->parent()->color() == RED) {
+                if (node->parent() == node->parent()->parent()->right) {
                         node = left_uncle(node);
                 } else {
                         node = right_uncle(node);
@@ -214,41 +294,43 @@ void RBT<ElemType>::balance_tree(Node *node)
                         break;
                 }
         }
-        root->color = BLACK;
+        bool grew = root->color() == RED;
+        root->set_color(BLACK);
+        return grew;
 }
 
 //left_uncle function
 //Parameters: Node *node - the root of the RBT subtree
 //Returns: Node - the new root of the passed in subtree
 //Does: Changes and updates RED/BLACK colors for subtree
-template<typename ElemType>
-typename RBT<ElemType>::Node *RBT<ElemType>::left_uncle(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename RBT<ElemType, Compare, StatsPolicy>::Node *RBT<ElemType, Compare, StatsPolicy>::left_uncle(Node *node)
 {
         Node *temp;
-        temp = node->parent->parent->left;
+        temp = node->parent()->parent()->left;
         if (temp != nullptr) {
-                if (temp->color == RED) {
-                        temp->color = BLACK;
-                        node->parent->color = BLACK;
-                        node->parent->parent->color = RED;
-                        node = node->parent->parent;
+                if (temp->color() == RED) {
+                        temp->set_color(BLACK);
+                        node->parent()->set_color(BLACK);
+                        node->parent()->parent()->set_color(RED);
+                        node = node->parent()->parent();
                 } else {
-                        if (node == node->parent->left) {
-                                node = node->parent;
+                        if (node == node->parent()->left) {
+                                node = node->parent();
                                 right_rotate(node);
                         }
-                        node->parent->color = BLACK;
-                        node->parent->parent->color = RED;
-                        left_rotate(node->parent->parent);
+                        node->parent()->set_color(BLACK);
+                        node->parent()->parent()->set_color(RED);
+                        left_rotate(node->parent()->parent());
                 }
         } else {
-                if (node == node->parent->left) {
-                        node = node->parent;
+                if (node == node->parent()->left) {
+                        node = node->parent();
                         right_rotate(node);
                 }
-                node->parent->color = BLACK;
-                node->parent->parent->color = RED;
-                left_rotate(node->parent->parent);
+                node->parent()->set_color(BLACK);
+                node->parent()->parent()->set_color(RED);
+                left_rotate(node->parent()->parent());
         }
         return node;
 }
@@ -257,34 +339,34 @@ typename RBT<ElemType>::Node *RBT<ElemType>::left_uncle(Node *node)
 //Parameters: Node *node - the root of the RBT subtree
 //Returns: Node 0 the new root of the passed in subtree
 //Does: Changes and updates RED/BLACK colors for subtree
-template<typename ElemType>
-typename RBT<ElemType>::Node *RBT<ElemType>::right_uncle(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename RBT<ElemType, Compare, StatsPolicy>::Node *RBT<ElemType, Compare, StatsPolicy>::right_uncle(Node *node)
 {
         Node *temp;
-        temp = node->parent->parent->right;
+        temp = node->parent()->parent()->right;
         if (temp != nullptr ) {
-                if (temp->color == BLACK) {
-                        if (node == node->parent->right) {
-                                node = node->parent;
+                if (temp->color() == BLACK) {
+                        if (node == node->parent()->right) {
+                                node = node->parent();
                                 left_rotate(node);
                         }
-                        node->parent->color = BLACK;
-                        node->parent->parent->color = RED;
-                        right_rotate(node->parent->parent);
+                        node->parent()->set_color(BLACK);
+                        node->parent()->parent()->set_color(RED);
+                        right_rotate(node->parent()->parent());
                 } else {
-                        temp->color = BLACK;
-                        node->parent->color = BLACK;
-                        node->parent->parent->color = RED;
-                        node = node->parent->parent;	
+                        temp->set_color(BLACK);
+                        node->parent()->set_color(BLACK);
+                        node->parent()->parent()->set_color(RED);
+                        node = node->parent()->parent();	
                 }
         } else {
-                if (node == node->parent->right) {
-                        node = node->parent;
+                if (node == node->parent()->right) {
+                        node = node->parent();
                         left_rotate(node);
                 }
-                node->parent->color = BLACK;
-                node->parent->parent->color = RED;
-                right_rotate(node->parent->parent);
+                node->parent()->set_color(BLACK);
+                node->parent()->parent()->set_color(RED);
+                right_rotate(node->parent()->parent());
         }
         return node;
 }
@@ -293,19 +375,19 @@ typename RBT<ElemType>::Node *RBT<ElemType>::right_uncle(Node *node)
 //Parameters: Node *x, Node *y - the nodes that are being swapped
 //Returns: Nothing
 //Does: Swap the passed in element's location within the RBT
-template<typename ElemType>
-void RBT<ElemType>::rb_swap(Node *x, Node *y)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void RBT<ElemType, Compare, StatsPolicy>::rb_swap(Node *x, Node *y)
 {
-        if (x->parent == nullptr) {
+        if (x->parent() == nullptr) {
                 root = y;
-        } else if (x == x->parent->left){
-                x->parent->left = y;
+        } else if (x == x->parent()->left){
+                x->parent()->left = y;
         } else {
-                x->parent->right = y;
+                x->parent()->right = y;
         }
         if (y != nullptr)
         {
-                y->parent = x->parent;
+                y->set_parent(x->parent());
         }
 }
 
@@ -313,9 +395,10 @@ void RBT<ElemType>::rb_swap(Node *x, Node *y)
 //Parameters: ElemType element - element being removed from the tree
 //Returns: Nothing
 //Does: Removes an element from the RBT 
-template<typename ElemType>
-void RBT<ElemType>::remove(ElemType element)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void RBT<ElemType, Compare, StatsPolicy>::remove(ElemType element)
 {
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
         remove_helper(root, element);
 }
 
@@ -324,20 +407,22 @@ void RBT<ElemType>::remove(ElemType element)
 //            ElemType element - the value being deleted from the tree
 //Returns: Nothing
 //Does: Finds and removes and element from the RBT
-template<typename ElemType>
-void RBT<ElemType>::remove_helper(Node *node, ElemType element)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void RBT<ElemType, Compare, StatsPolicy>::remove_helper(Node *node, ElemType element)
 {
         Node *elem_node = nullptr;
-        Node *new_root, *temp_node;
         while (node != nullptr){
-                if (node->data == element) {
+                StatsPolicy::node_visit();
+                int cmp = compare_keys(element, node->data);
+                if (cmp == 0) {
                         if (node->count > 1) {
                                 node->count--;
                                 return;
                         }
                         elem_node = node;
+                        break;
                 }
-                if (node->data <= element) {
+                if (cmp > 0) {
                         node = node->right;
                 } else {
                         node = node->left;
@@ -346,110 +431,430 @@ void RBT<ElemType>::remove_helper(Node *node, ElemType element)
         if (elem_node == nullptr) {
                 return;
         } 
+        remove_node(elem_node);
+}
+
+//remove_node function
+//Parameters: Node *elem_node - the node being removed
+//Returns: Nothing
+//Does: Unlinks the node from the tree and deletes it
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void RBT<ElemType, Compare, StatsPolicy>::remove_node(Node *elem_node)
+{
+        unlink_node(elem_node);
+        delete elem_node;
+}
+
+//unlink_node function
+//Parameters: Node *elem_node - the node being taken out of the tree
+//Returns: Nothing
+//Does: Unlinks the node (replacing it with its successor when it has two
+//      children) and fixes the colors if a BLACK node was taken out of
+//      the tree. The node itself is left allocated
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void RBT<ElemType, Compare, StatsPolicy>::unlink_node(Node *elem_node)
+{
+        Node *new_root, *new_root_parent, *temp_node;
         temp_node = elem_node;
-        Colors temp_node_original_color = temp_node->color;
+        Colors temp_node_original_color = temp_node->color();
         if (elem_node->left == nullptr) {
                 new_root = elem_node->right;
+                new_root_parent = elem_node->parent();
                 rb_swap(elem_node, elem_node->right);
         } else if (elem_node->right == nullptr) {
                 new_root = elem_node->left;
+                new_root_parent = elem_node->parent();
                 rb_swap(elem_node, elem_node->left);
         } else {
                 temp_node = min_node(elem_node->right);
-                temp_node_original_color = temp_node->color;
+                temp_node_original_color = temp_node->color();
                 new_root = temp_node->right;
-                if (temp_node->parent == elem_node) {
-                        new_root->parent = temp_node;
+                if (temp_node->parent() == elem_node) {
+                        new_root_parent = temp_node;
                 } else {
+                        new_root_parent = temp_node->parent();
                         rb_swap(temp_node, temp_node->right);
                         temp_node->right = elem_node->right;
-                        temp_node->right->parent = temp_node;
+                        temp_node->right->set_parent(temp_node);
                 }
 
                 rb_swap(elem_node, temp_node);
                 temp_node->left = elem_node->left;
-                temp_node->left->parent = temp_node;
-                temp_node->color = elem_node->color;
+                temp_node->left->set_parent(temp_node);
+                temp_node->set_color(elem_node->color());
         }
-        delete elem_node;
-        if (temp_node_original_color == RED){
-                if (new_root != nullptr) {
-                        balance_after_delete(new_root);
+        augment_path(new_root_parent);
+        if (temp_node_original_color == BLACK){
+                balance_after_delete(new_root, new_root_parent);
+        }
+}
+
+//remove_range function
+//Parameters: const ElemType &lo, const ElemType &hi - bounds of the
+//            range being removed (both inclusive)
+//Returns: int - the number of elements removed, counting duplicates
+//Does: Splits the tree into the elements below, inside and above the
+//      range, deletes the middle tree whole and joins the other two
+//      instead of removing and rebalancing one element at a time
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int RBT<ElemType, Compare, StatsPolicy>::remove_range(const ElemType &lo, const ElemType &hi)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
+        if (compare_keys(hi, lo) < 0) {
+                return 0;
+        }
+        Node *below, *rest, *inside, *above;
+        int below_height, rest_height, inside_height, above_height;
+        split(root, black_height(root), lo, false, below, below_height,
+              rest, rest_height);
+        split(rest, rest_height, hi, true, inside, inside_height,
+              above, above_height);
+        root = join2(below, above);
+        return remove_subtree(inside);
+}
+
+//remove_less_than function
+//Parameters: const ElemType &key - elements ordered before key are removed
+//Returns: int - the number of elements removed, counting duplicates
+//Does: Splits off every element less than key and deletes it, used to
+//      expire old keys without rebalancing once per key
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int RBT<ElemType, Compare, StatsPolicy>::remove_less_than(const ElemType &key)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
+        Node *below, *above;
+        int below_height, above_height;
+        split(root, black_height(root), key, false, below, below_height,
+              above, above_height);
+        root = above;
+        return remove_subtree(below);
+}
+
+//split function
+//Parameters: Node *node - the root of the tree being split
+//            int height - the black height of that tree
+//            const ElemType &key - the value the tree is split at
+//            bool inclusive - whether elements equal to key go left
+//            Node *&left - set to the tree of elements before key
+//            int &left_height - set to the black height of left
+//            Node *&right - set to the tree of elements after key
+//            int &right_height - set to the black height of right
+//Returns: Nothing
+//Does: Walks down the search path for key, joining the subtrees hanging
+//      off each side of the path back together on the way up. The black
+//      height of each subtree is worked out from its parent's on the way
+//      down, so no join has to measure one and the split is O(log n)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void RBT<ElemType, Compare, StatsPolicy>::split(Node *node, int height, const ElemType &key,
+                                bool inclusive, Node *&left, int &left_height,
+                                Node *&right, int &right_height)
+{
+        if (node == nullptr) {
+                left = right = nullptr;
+                left_height = right_height = 0;
+                return;
+        }
+        StatsPolicy::node_visit();
+        int cmp = compare_keys(key, node->data);
+        Node *sub_left = node->left;
+        Node *sub_right = node->right;
+        int sub_height = height - (node->color() == BLACK ? 1 : 0);
+        Node *part;
+        int part_height;
+        if (cmp > 0 || (inclusive && cmp == 0)) {
+                split(sub_right, sub_height, key, inclusive, part, part_height,
+                      right, right_height);
+                left = join(sub_left, sub_height, node, part, part_height,
+                            left_height);
+        } else {
+                split(sub_left, sub_height, key, inclusive, left, left_height,
+                      part, part_height);
+                right = join(part, part_height, node, sub_right, sub_height,
+                             right_height);
+        }
+}
+
+//join function
+//Parameters: Node *left - tree of elements before mid
+//            int left_height - the black height of left
+//            Node *mid - detached node placed between the two trees
+//            Node *right - tree of elements after mid
+//            int right_height - the black height of right
+//            int &height - set to the black height of the joined tree
+//Returns: Node - the root of the joined tree
+//Does: Walks down the side of the tree with the larger black height to
+//      a BLACK node of the other tree's black height, hangs mid there as
+//      a RED node and runs the insert fixup from it. Takes the black
+//      heights from the caller instead of measuring them, so the cost is
+//      the difference of the heights plus the fixup
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename RBT<ElemType, Compare, StatsPolicy>::Node *RBT<ElemType, Compare, StatsPolicy>::join(Node *left, int left_height, Node *mid,
+                                Node *right, int right_height, int &height)
+{
+        if (left != nullptr) {
+                if (left->color() == RED) {
+                        left_height++;
+                }
+                left->set_parent(nullptr);
+                left->set_color(BLACK);
+        }
+        if (right != nullptr) {
+                if (right->color() == RED) {
+                        right_height++;
+                }
+                right->set_parent(nullptr);
+                right->set_color(BLACK);
+        }
+        mid->set_parent(nullptr);
+        if (left_height == right_height) {
+                mid->left = left;
+                mid->right = right;
+                mid->set_color(BLACK);
+                if (left != nullptr) {
+                        left->set_parent(mid);
+                }
+                if (right != nullptr) {
+                        right->set_parent(mid);
+                }
+                augment_node(mid);
+                height = left_height + 1;
+                return mid;
+        }
+        Node *parent = nullptr;
+        Node *node;
+        int walk_height;
+        if (left_height > right_height) {
+                root = left;
+                node = left;
+                height = walk_height = left_height;
+                while (node_color(node) == RED || walk_height != right_height) {
+                        if (node->color() == BLACK) {
+                                walk_height--;
+                        }
+                        parent = node;
+                        node = node->right;
+                }
+                mid->left = node;
+                mid->right = right;
+                parent->right = mid;
+        } else {
+                root = right;
+                node = right;
+                height = walk_height = right_height;
+                while (node_color(node) == RED || walk_height != left_height) {
+                        if (node->color() == BLACK) {
+                                walk_height--;
+                        }
+                        parent = node;
+                        node = node->left;
+                }
+                mid->left = left;
+                mid->right = node;
+                parent->left = mid;
+        }
+        mid->set_parent(parent);
+        mid->set_color(RED);
+        if (mid->left != nullptr) {
+                mid->left->set_parent(mid);
+        }
+        if (mid->right != nullptr) {
+                mid->right->set_parent(mid);
+        }
+        augment_path(mid);
+        if (parent->color() == RED && balance_tree(mid)) {
+                height++;
+        }
+        return root;
+}
+
+//join2 function
+//Parameters: Node *left - tree of elements before right
+//            Node *right - tree of elements after left
+//Returns: Node - the root of the joined tree
+//Does: Unlinks the minimum of the right tree and uses it as the middle
+//      node of a join. Only called once per range removal, so measuring
+//      the two black heights here keeps it O(log n)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename RBT<ElemType, Compare, StatsPolicy>::Node *RBT<ElemType, Compare, StatsPolicy>::join2(Node *left, Node *right)
+{
+        if (right == nullptr) {
+                if (left != nullptr) {
+                        left->set_parent(nullptr);
+                        left->set_color(BLACK);
+                }
+                return left;
+        }
+        right->set_parent(nullptr);
+        right->set_color(BLACK);
+        if (left == nullptr) {
+                return right;
+        }
+        root = right;
+        Node *mid = min_node(right);
+        unlink_node(mid);
+        int height;
+        return join(left, black_height(left), mid, root, black_height(root),
+                    height);
+}
+
+//black_height function
+//Parameters: Node *node - the root of a tree
+//Returns: int - the number of BLACK nodes from the root down to a leaf
+//Does: Counts the BLACK nodes on the leftmost path, which equals the
+//      count on every path of a valid RBT
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int RBT<ElemType, Compare, StatsPolicy>::black_height(Node *node)
+{
+        int height = 0;
+        while (node != nullptr) {
+                if (node->color() == BLACK) {
+                        height++;
                 }
+                node = node->left;
         }
+        return height;
+}
+
+//remove_subtree function
+//Parameters: Node *node - the root of a tree detached from the RBT
+//Returns: int - the number of elements stored in it, counting duplicates
+//Does: Deletes every node of the tree
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int RBT<ElemType, Compare, StatsPolicy>::remove_subtree(Node *node)
+{
+        if (node == nullptr) {
+                return 0;
+        }
+        int removed = node->count + remove_subtree(node->left) +
+                      remove_subtree(node->right);
+        delete node;
+        return removed;
 }
 
 //balance_after_delete function
-//Parameters: Node *node - the root of the subtree
+//Parameters: Node *node - the node that took the removed node's place,
+//                         possibly nullptr
+//            Node *parent - the parent of that node
 //Returns: Nothing
 //Does: Changes and updates the RED/BLACK color of each node 
 //      in order to maintain invariants
-template<typename ElemType>
-void RBT<ElemType>::balance_after_delete(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void RBT<ElemType, Compare, StatsPolicy>::balance_after_delete(Node *node, Node *parent)
 {
         Node *temp;
-        while (node != root && node->color == RED) {
-                if (node == node->parent->left) {
-                        temp = node->parent->right;
-                        if (temp->color == BLACK) {
-                                temp->color = RED;
-                                node->parent->color = BLACK;
-                                left_rotate(node->parent);
-                                temp = node->parent->right;
+        while (node != root && node_color(node) == BLACK) {
+                if (node == parent->left) {
+                        temp = parent->right;
+                        if (temp->color() == RED) {
+                                temp->set_color(BLACK);
+                                parent->set_color(RED);
+                                left_rotate(parent);
+                                temp = parent->right;
                         }
 
-                        if (temp->left->color == RED && temp->right->color == RED) {
-                                temp->color = BLACK;
-                                node = node->parent;
+                        if (node_color(temp->left) == BLACK && node_color(temp->right) == BLACK) {
+                                temp->set_color(RED);
+                                node = parent;
+                                parent = node->parent();
                         } else {
-                                if (temp->right->color == RED) {
-                                        temp->left->color = RED;
-                                        temp->color = BLACK;
+                                if (node_color(temp->right) == BLACK) {
+                                        temp->left->set_color(BLACK);
+                                        temp->set_color(RED);
                                         right_rotate(temp);
-                                        temp = node->parent->right;
+                                        temp = parent->right;
                                 } 
-                                temp->color = node->parent->color;
-                                node->parent->color = RED;
-                                temp->right->color = RED;
-                                left_rotate(node->parent);
+                                temp->set_color(parent->color());
+                                parent->set_color(BLACK);
+                                temp->right->set_color(BLACK);
+                                left_rotate(parent);
                                 node = root;
                         }
                 } else {
-                        temp = node->parent->left;
-                        if (temp->color == BLACK) {
-                                temp->color = RED;
-                                node->parent->color = BLACK;
-                                right_rotate(node->parent);
-                                temp = node->parent->left;
+                        temp = parent->left;
+                        if (temp->color() == RED) {
+                                temp->set_color(BLACK);
+                                parent->set_color(RED);
+                                right_rotate(parent);
+                                temp = parent->left;
                         }
 
-                        if (temp->right->color == RED && temp->right->color == RED) {
-                                temp->color = BLACK;
-                                node = node->parent;
+                        if (node_color(temp->left) == BLACK && node_color(temp->right) == BLACK) {
+                                temp->set_color(RED);
+                                node = parent;
+                                parent = node->parent();
                         } else {
-                                if (temp->left->color == RED) {
-                                        temp->right->color = RED;
-                                        temp->color = BLACK;
+                                if (node_color(temp->left) == BLACK) {
+                                        temp->right->set_color(BLACK);
+                                        temp->set_color(RED);
                                         left_rotate(temp);
-                                        temp = node->parent->left;
+                                        temp = parent->left;
                                 } 
-                                temp->color = node->parent->color;
-                                node->parent->color = RED;
-                                temp->left->color = RED;
-                                right_rotate(node->parent);
+                                temp->set_color(parent->color());
+                                parent->set_color(BLACK);
+                                temp->left->set_color(BLACK);
+                                right_rotate(parent);
                                 node = root;
                         }
                 } 
         }
-        node->color = RED;
+        if (node != nullptr) {
+                node->set_color(BLACK);
+        }
+}
+
+//node_color function
+//Parameters: Node *node - the node being checked, possibly nullptr
+//Returns: Colors - the color of the node
+//Does: Treats the null leaves of the tree as BLACK nodes
+template<typename ElemType, typename Compare, typename StatsPolicy>
+Colors RBT<ElemType, Compare, StatsPolicy>::node_color(Node *node)
+{
+        if (node == nullptr) {
+                return BLACK;
+        }
+        return node->color();
+}
+
+//augment_node function
+//Parameters: Node *node - the node whose summary is recomputed
+//Returns: Nothing
+//Does: Rebuilds the node's augmented summary from its children, does
+//      nothing unless RBTAugment is specialised for ElemType
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void RBT<ElemType, Compare, StatsPolicy>::augment_node(Node *node)
+{
+        if (!RBTAugment<ElemType>::enabled) {
+                return;
+        }
+        RBTAugment<ElemType>::update(node->data,
+                        node->left == nullptr ? nullptr : &node->left->data,
+                        node->right == nullptr ? nullptr : &node->right->data);
+}
+
+//augment_path function
+//Parameters: Node *node - the lowest node whose subtree changed,
+//                         possibly nullptr
+//Returns: Nothing
+//Does: Rebuilds the augmented summaries of the node and all of its
+//      ancestors after a node is linked in or taken out
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void RBT<ElemType, Compare, StatsPolicy>::augment_path(Node *node)
+{
+        if (!RBTAugment<ElemType>::enabled) {
+                return;
+        }
+        while (node != nullptr) {
+                augment_node(node);
+                node = node->parent();
+        }
 }
 
 //min_node function
 //Parameters: Node *node - the root of the subtree being passed in 
 //Returns: Node - the node of the minimum value
 //Does: Given the root of a subtree, function returns the node containing the value
-template<typename ElemType>
-typename RBT<ElemType>::Node *RBT<ElemType>::min_node(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename RBT<ElemType, Compare, StatsPolicy>::Node *RBT<ElemType, Compare, StatsPolicy>::min_node(Node *node)
 {
         while (node->left != nullptr) {
                 node = node->left;
@@ -461,58 +866,171 @@ typename RBT<ElemType>::Node *RBT<ElemType>::min_node(Node *node)
 //Parameters: ElemType element - value stored in the new node
 //Returns: Node - a new node being created
 //Does: Allocates memory for a new node, initializes values, and returns new node
-template<typename ElemType>
-typename RBT<ElemType>::Node *RBT<ElemType>::new_node(ElemType element)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename RBT<ElemType, Compare, StatsPolicy>::Node *RBT<ElemType, Compare, StatsPolicy>::new_node(ElemType element)
 {
         Node *temp_node = new Node();
         temp_node->data = element;
-        temp_node->color = RED;
+        temp_node->set_color(RED);
         temp_node->count = 1;
         temp_node->left = nullptr;
         temp_node->right = nullptr;
-        temp_node->parent = nullptr;
+        temp_node->set_parent(nullptr);
         return temp_node;
 }
 
 //contains function 
-//Paramters: ElemType element - the value being checked for
+//Paramters: const ElemType &element - the value being checked for
 //Returns: bool - whether or not the value is stored in the tree
 //Does: Checks if a passed in value is stored within the tree 
-template<typename ElemType>
-bool RBT<ElemType>::contains(ElemType element)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+bool RBT<ElemType, Compare, StatsPolicy>::contains(const ElemType &element)
 {
-        return contains_recur(root, element);
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        return find_node(element) != nullptr;
 }
 
-//contains_recur Function
-//Parameters: Node *node - the root of the current tree being checked 
-//            ElemType element - the value being checked for 
-//Returns: bool - whether or not the value is stored in the tree 
-//Does: Checks, recursively, if a value is stored in the tree 
-template<typename ElemType>
-bool RBT<ElemType>::contains_recur(Node *node, ElemType element)
+//contains function (heterogeneous)
+//Parameters: const Key &key - a value comparable with ElemType
+//Returns: bool - whether or not an equal value is stored in the tree
+//Does: Looks up a key of another type (for example a string_view in a
+//      tree of strings) without constructing an ElemType. Only enabled
+//      when Compare declares is_transparent
+template<typename ElemType, typename Compare, typename StatsPolicy>
+template<typename Key, typename C, typename>
+bool RBT<ElemType, Compare, StatsPolicy>::contains(const Key &key)
 {
-        if (node == nullptr) 
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        return find_node(key) != nullptr;
+}
+
+//contains_batch function
+//Parameters: const ElemType *keys - the values being checked for
+//            int n - the number of keys
+//            bool *out - n flags, out[i] is set to whether keys[i] is
+//                        stored in the tree
+//Returns: Nothing
+//Does: Looks up every key, overlapping the cache misses of many
+//      descents (see lookup_batch)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void RBT<ElemType, Compare, StatsPolicy>::contains_batch(const ElemType *keys, int n, bool *out)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        lookup_batch(keys, n, out);
+}
+
+//contains_batch function (counting)
+//Parameters: const ElemType *keys - the values being checked for
+//            int n - the number of keys
+//Returns: int - how many of the keys are stored in the tree
+//Does: Same as the flag version without writing per key results
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int RBT<ElemType, Compare, StatsPolicy>::contains_batch(const ElemType *keys, int n)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        return lookup_batch(keys, n, nullptr);
+}
+
+//lookup_batch function (private)
+//Parameters: const ElemType *keys - the values being checked for
+//            int n - the number of keys
+//            bool *out - per key results, or nullptr to only count
+//Returns: int - how many of the keys were found
+//Does: Keeps BATCH_LANES descents going at once and moves each of them
+//      one level per round. The child a lane moves to is prefetched and
+//      only read a full round later, so the misses of the different
+//      lanes overlap instead of each level of each lookup stalling on
+//      its own. A finished lane immediately starts the next key
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int RBT<ElemType, Compare, StatsPolicy>::lookup_batch(const ElemType *keys, int n, bool *out)
+{
+        int lane_key[BATCH_LANES];
+        Node *lane_node[BATCH_LANES];
+        int active = 0;
+        int next_key = 0;
+        int found = 0;
+        while (active < BATCH_LANES and next_key < n)
         {
-                return false;
+                lane_key[active] = next_key;
+                lane_node[active] = root;
+                active++;
+                next_key++;
         }
-        if (node->data == element) 
+        while (active > 0)
         {
-                return true;
+                int lane = 0;
+                while (lane < active)
+                {
+                        Node *node = lane_node[lane];
+                        int cmp = 1;
+                        if (node != nullptr)
+                        {
+                                StatsPolicy::node_visit();
+                                cmp = compare_keys(keys[lane_key[lane]], node->data);
+                                node = (cmp < 0) ? node->left : node->right;
+                        }
+                        if (cmp != 0 and node != nullptr)
+                        {
+                                TREE_PREFETCH(node);
+                                lane_node[lane] = node;
+                                lane++;
+                                continue;
+                        }
+                        if (cmp == 0)
+                        {
+                                found++;
+                        }
+                        if (out != nullptr)
+                        {
+                                out[lane_key[lane]] = (cmp == 0);
+                        }
+                        if (next_key < n)
+                        {
+                                lane_key[lane] = next_key;
+                                lane_node[lane] = root;
+                                next_key++;
+                                lane++;
+                        }
+                        else
+                        {
+                                active--;
+                                lane_key[lane] = lane_key[active];
+                                lane_node[lane] = lane_node[active];
+                        }
+                }
         }
-        if (node->data < element)
+        return found;
+}
+
+//find_node Function
+//Parameters: const Key &key - the value being looked for
+//Returns: Node - the node storing an equal value, nullptr if none
+//Does: Walks down from the root making a single three way comparison
+//      at each node
+template<typename ElemType, typename Compare, typename StatsPolicy>
+template<typename Key>
+typename RBT<ElemType, Compare, StatsPolicy>::Node *RBT<ElemType, Compare, StatsPolicy>::find_node(const Key &key)
+{
+        Node *node = root;
+        while (node != nullptr)
         {
-                return contains_recur(node->left, element);
+                StatsPolicy::node_visit();
+                int cmp = compare_keys(key, node->data);
+                if (cmp == 0)
+                {
+                        return node;
+                }
+                node = (cmp < 0) ? node->left : node->right;
         }
-        return contains_recur(node->right, element);
+        return nullptr;
 }
 
 //tree_height Function 
 //Parameters: Nothing 
 //Returns: Int - the height of the tree
 //Does: Searches for and returns the height of the RBT Tree
-template<typename ElemType>
-int RBT<ElemType>::tree_height()
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int RBT<ElemType, Compare, StatsPolicy>::tree_height()
 {
         return tree_height_recur(root);
 }
@@ -521,8 +1039,8 @@ int RBT<ElemType>::tree_height()
 //Parameters: Node *node - the root of the tree currently being manipulated
 //Returns: Int - the height of the current tree
 //Does: Checks and returns the height of the current tree
-template<typename ElemType>
-int RBT<ElemType>::tree_height_recur(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int RBT<ElemType, Compare, StatsPolicy>::tree_height_recur(Node *node)
 {
         if (root == nullptr)
         {
@@ -549,8 +1067,8 @@ int RBT<ElemType>::tree_height_recur(Node *node)
 //Parameters: Nothing 
 //Returns: Int - total node count
 //Does: Returns the total amount of nodes in a tree
-template<typename ElemType>
-int RBT<ElemType>::node_count()
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int RBT<ElemType, Compare, StatsPolicy>::node_count()
 {
         return node_count_recur(root);
 }
@@ -560,8 +1078,8 @@ int RBT<ElemType>::node_count()
 //Returns: Int - the number of nodes in the current tree
 //Does: Checks for the number of nodes in the tree starting at the
 //      passed in node 
-template<typename ElemType>
-int RBT<ElemType>::node_count_recur(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int RBT<ElemType, Compare, StatsPolicy>::node_count_recur(Node *node)
 {
         int total_count = 0;
         if (node == nullptr)
@@ -577,8 +1095,8 @@ int RBT<ElemType>::node_count_recur(Node *node)
 //Parameters: Nothing 
 //Returns: int - total value of all nodes
 //Does: Returns the sum of all the node values (including duplicates)
-template<typename ElemType>
-int RBT<ElemType>::count_total()
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int RBT<ElemType, Compare, StatsPolicy>::count_total()
 {
         return count_total_recur(root);
 }
@@ -588,8 +1106,8 @@ int RBT<ElemType>::count_total()
 //Returns: Int - sum of all values in current tree
 //Does: Returns the sum of all the node values (including duplicates)
 //      in the tree starting at the passed in node
-template<typename ElemType>
-int RBT<ElemType>::count_total_recur(Node *node)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int RBT<ElemType, Compare, StatsPolicy>::count_total_recur(Node *node)
 {
         if (node == nullptr)
         {
@@ -608,8 +1126,8 @@ int RBT<ElemType>::count_total_recur(Node *node)
 //Returns: Nothing
 //Does: prints all elements within the tree (uncomment the type 
 //      of traversal used)
-template<typename ElemType>
-void RBT<ElemType>::print_tree()
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void RBT<ElemType, Compare, StatsPolicy>::print_tree()
 {
         //Uncomment the type of traversal wanted:
         // in_order_print(root);
@@ -623,8 +1141,8 @@ void RBT<ElemType>::print_tree()
 //Returns: Nothing
 //Does: Prints the contents of the tree using
 //      an in-order traversal
-template<typename ElemType>
-void RBT<ElemType>::in_order_print(Node *root)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void RBT<ElemType, Compare, StatsPolicy>::in_order_print(Node *root)
 {
         if (root == nullptr)
         {
@@ -640,8 +1158,8 @@ void RBT<ElemType>::in_order_print(Node *root)
 //Returns: Nothing
 //Does: Prints the contents of the tree using
 //      a pre-order traversal
-template<typename ElemType>
-void RBT<ElemType>::pre_order_print(Node *root)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void RBT<ElemType, Compare, StatsPolicy>::pre_order_print(Node *root)
 {
         stack<Node *> list;
         if (root != nullptr){
@@ -665,8 +1183,8 @@ void RBT<ElemType>::pre_order_print(Node *root)
 //Returns: Nothing
 //Does: Prints the contents of the tree using 
 //      a level-order traversal
-template<typename ElemType>
-void RBT<ElemType>::level_order_print(Node *root)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void RBT<ElemType, Compare, StatsPolicy>::level_order_print(Node *root)
 {
         queue<Node *> list;
         if (root != nullptr) 
@@ -675,7 +1193,7 @@ void RBT<ElemType>::level_order_print(Node *root)
         }
         while (!list.empty()) 
         {
-                cout << list.front()->data << " " << list.front()->color << " ";
+                cout << list.front()->data << " " << list.front()->color() << " ";
                 if (list.front()->left != nullptr) 
                 {
                         list.push(list.front()->left);
@@ -686,4 +1204,42 @@ void RBT<ElemType>::level_order_print(Node *root)
                 }
                 list.pop();
         }
-}
\ No newline at end of file
+}
+
+//stats function
+//Parameters: Nothing
+//Returns: StatsSnapshot - copy of the counters kept by the StatsPolicy
+//Does: Reports comparisons, rotations, node visits and per operation
+//      latencies (all zero unless the tree is built with OpStats)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+StatsSnapshot RBT<ElemType, Compare, StatsPolicy>::stats()
+{
+        return StatsPolicy::snapshot();
+}
+
+//memory_usage function
+//Parameters: Nothing
+//Returns: size_t - bytes used by the nodes
+//Does: Multiplies the node count by the node size. Divide by
+//      node_count() for the overhead per key
+template<typename ElemType, typename Compare, typename StatsPolicy>
+size_t RBT<ElemType, Compare, StatsPolicy>::memory_usage()
+{
+        return node_count() * sizeof(Node);
+}
+
+//compare_keys function
+//Parameters: const A &a, const B &b - keys being compared
+//Returns: int - negative if a orders before b, zero if they are equal,
+//         positive if a orders after b
+//Does: Compares two keys with the tree's comparator, counting the
+//      comparison
+template<typename ElemType, typename Compare, typename StatsPolicy>
+template<typename A, typename B>
+int RBT<ElemType, Compare, StatsPolicy>::compare_keys(const A &a, const B &b)
+{
+        StatsPolicy::comparison();
+        return compare(a, b);
+}
+
+#endif
\ No newline at end of file
@@ -12,15 +12,35 @@
 #ifndef RBT_H_
 #define RBT_H_
 
+#include "../Comparators/ThreeWayCompare.h"
+#include "../Instrumentation/OpStats.h"
+
+#include <cstddef>
+#include <cstdint>
+
 //define the color options for each node
 enum Colors {RED, BLACK};
 
+//per node augmentation hook. Trees that keep a summary of each subtree
+//in their elements (e.g. the max endpoint of an interval tree) specialise
+//this so update recomputes the summary from the two children; the
+//default does nothing and the tree never calls it
 template<typename ElemType>
-class RBT
+struct RBTAugment
+{
+        static const bool enabled = false;
+        static void update(ElemType &, const ElemType *, const ElemType *) {}
+};
+
+template<typename ElemType, typename Compare = ThreeWayCompare,
+         typename StatsPolicy = NoStats>
+class RBT : protected StatsPolicy
 {
         public:
                 //Constructor
                 RBT();
+                //Comparator Constructor
+                RBT(const Compare &comp);
                 //Destructor
                 ~RBT();
                 //Copy Constructor
@@ -28,11 +48,25 @@ class RBT
                 //Assignment Operator
                 RBT &operator=(const RBT &rhs);
                 //checks if an element is stored in the BST 
-                bool contains(ElemType element);
+                bool contains(const ElemType &element);
+                //checks if an element equal to the key is stored, without
+                //converting the key to an ElemType (transparent Compare only)
+                template<typename Key, typename C = Compare,
+                         typename = typename C::is_transparent>
+                bool contains(const Key &key);
+                //checks n keys at once, out[i] is set to whether keys[i]
+                //is stored
+                void contains_batch(const ElemType *keys, int n, bool *out);
+                //returns how many of the n keys are stored
+                int contains_batch(const ElemType *keys, int n);
                 //inserts an element
                 void insert(ElemType element);
                 //removes an element
                 void remove(ElemType element);
+                //removes every element in [lo, hi], returns how many
+                int remove_range(const ElemType &lo, const ElemType &hi);
+                //removes every element less than key, returns how many
+                int remove_less_than(const ElemType &key);
                 //Checks the height of the tree
                 int tree_height();
                 //Counts number of nodes
@@ -41,28 +75,58 @@ class RBT
                 int count_total();
                 //prints values stored in the BST
                 void print_tree();
-        private:
+                //returns a snapshot of the operation counters
+                StatsSnapshot stats();
+                //returns the bytes held by the tree's nodes
+                size_t memory_usage();
+        protected:
 
-                //struct to store node information
+                //struct to store node information. Nodes are pointer
+                //aligned, so the low bit of the parent pointer is always
+                //zero and holds the color instead of a separate field
                 struct Node 
                 {
                         ElemType data;
                         int count;
-                        Colors color;
                         Node *left;
                         Node *right;
-                        Node *parent;
+                        uintptr_t parent_color;
+
+                        Node *parent() const
+                        {
+                                return (Node *)(parent_color & ~(uintptr_t)1);
+                        }
+                        void set_parent(Node *node)
+                        {
+                                parent_color = (uintptr_t)node | (parent_color & 1);
+                        }
+                        Colors color() const
+                        {
+                                return (Colors)(parent_color & 1);
+                        }
+                        void set_color(Colors color)
+                        {
+                                parent_color = (parent_color & ~(uintptr_t)1) | color;
+                        }
                 };
                 //root of the RBT
                 Node *root;
+                //orders the elements
+                Compare compare;
                 //creates a deep copy of a tree
                 Node *copy_tree(Node *node);
                 //removes all nodes from a tree
                 void delete_tree(Node *node);
                 //creates and allocates memory for a new node
                 Node *new_node(ElemType element);
+                //finds the node equal to a key, or the parent and side a new
+                //node with that key would be linked under
+                template<typename Key>
+                Node *find_slot(const Key &key, Node *&parent, int &cmp);
+                //links a new node where find_slot left off and rebalances
+                void attach_node(Node *node, Node *parent, int cmp);
                 //balances a tree to satisfy invariants
-                void balance_tree(Node *node);
+                bool balance_tree(Node *node);
                 //Updates color if there is a right sibling to the current node's parent
                 Node *left_uncle(Node *node);
                 //Updates color if there is a left sibling to the current node's parent
@@ -77,10 +141,38 @@ class RBT
                 void remove_helper(Node *node, ElemType element);
                 //finds the minimum node stored in a subtree
                 Node *min_node(Node *node);
+                //unlinks and deletes a node, rebalancing the tree
+                void remove_node(Node *elem_node);
+                //unlinks a node without deleting it, rebalancing the tree
+                void unlink_node(Node *elem_node);
+                //splits a tree into the elements before and after a key
+                void split(Node *node, int height, const ElemType &key,
+                           bool inclusive, Node *&left, int &left_height,
+                           Node *&right, int &right_height);
+                //joins two trees of known black heights around a middle node
+                Node *join(Node *left, int left_height, Node *mid,
+                           Node *right, int right_height, int &height);
+                //joins two trees with no middle node
+                Node *join2(Node *left, Node *right);
+                //counts the BLACK nodes on the leftmost path of a tree
+                int black_height(Node *node);
+                //deletes a detached subtree, returns the elements it held
+                int remove_subtree(Node *node);
                 //balances tree by updating color to maintain RBT invariants after deletion
-                void balance_after_delete(Node *node);
-                //checks if an element is stored in an AVL
-                bool contains_recur(Node *node, ElemType element);
+                void balance_after_delete(Node *node, Node *parent);
+                //returns the color of a node, null leaves count as BLACK
+                Colors node_color(Node *node);
+                //recomputes the augmented summary of a node
+                void augment_node(Node *node);
+                //recomputes the augmented summaries from a node up to the root
+                void augment_path(Node *node);
+                //finds the node storing an element equal to the key
+                template<typename Key>
+                Node *find_node(const Key &key);
+                //number of lookups contains_batch keeps in flight
+                static const int BATCH_LANES = 16;
+                //interleaved descents behind both contains_batch versions
+                int lookup_batch(const ElemType *keys, int n, bool *out);
                 //finds the height of a tree starting at the passed in node
                 int tree_height_recur(Node *node);
                 //counts the number of nodes starting at the passed in node
@@ -94,6 +186,9 @@ class RBT
                 void pre_order_print(Node *root);
                 //level order traversal print
                 void level_order_print(Node *root);
+                //three way comparison of two keys, counting the comparison
+                template<typename A, typename B>
+                int compare_keys(const A &a, const B &b);
 };
 
 #endif
\ No newline at end of file
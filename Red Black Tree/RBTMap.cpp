@@ -0,0 +1,197 @@
+/*
+ *
+ * Red Black Tree Map Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * RBTMap.cpp
+ * Full function declaration
+ *
+ */
+
+#include "RBTMap.h"
+#include "RBT.cpp"
+#include <stdexcept>
+
+using namespace std;
+
+//default constructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Initializes an empty instance of the Class
+template<typename Key, typename Value, typename Compare, typename StatsPolicy>
+RBTMap<Key, Value, Compare, StatsPolicy>::RBTMap()
+{
+        num_entries = 0;
+}
+
+//comparator constructor
+//Parameters: const Compare &comp - the comparator used to order keys
+//Returns: Nothing
+//Does: Initializes an empty instance of the Class that orders its
+//      keys with the passed in comparator
+template<typename Key, typename Value, typename Compare, typename StatsPolicy>
+RBTMap<Key, Value, Compare, StatsPolicy>::RBTMap(const Compare &comp)
+        : Tree(EntryCompare<Compare>(comp))
+{
+        num_entries = 0;
+}
+
+//contains function
+//Parameters: const K &key - the key being checked for
+//Returns: bool - whether or not the key is stored in the map
+//Does: Checks if a key is stored in the map
+template<typename Key, typename Value, typename Compare, typename StatsPolicy>
+template<typename K>
+bool RBTMap<Key, Value, Compare, StatsPolicy>::contains(const K &key)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        return Tree::find_node(key) != nullptr;
+}
+
+//find function
+//Parameters: const K &key - the key being looked up
+//Returns: Value & - the value stored under the key
+//Does: Finds the node for the key in a single descent and returns its
+//      value, throws if the key is not stored
+template<typename Key, typename Value, typename Compare, typename StatsPolicy>
+template<typename K>
+Value &RBTMap<Key, Value, Compare, StatsPolicy>::find(const K &key)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        Node *node = Tree::find_node(key);
+        if (node == nullptr)
+        {
+                throw runtime_error("Key is not stored in the map");
+        }
+        return node->data.value;
+}
+
+//insert_or_assign function
+//Parameters: const Key &key - the key being stored
+//            const Value &value - the value stored under the key
+//Returns: bool - true if the key was new, false if its value was replaced
+//Does: Stores the value under the key, overwriting any previous value
+template<typename Key, typename Value, typename Compare, typename StatsPolicy>
+bool RBTMap<Key, Value, Compare, StatsPolicy>::insert_or_assign(const Key &key,
+                                                        const Value &value)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
+        bool inserted;
+        Node *node = emplace_node(key, inserted, value);
+        if (!inserted)
+        {
+                node->data.value = value;
+        }
+        return inserted;
+}
+
+//try_emplace function
+//Parameters: const Key &key - the key being stored
+//            Args&&... args - arguments the value is constructed from
+//Returns: bool - true if the key was new, false if it was already stored
+//Does: Constructs the value under the key only if the key is missing,
+//      an existing value is left untouched
+template<typename Key, typename Value, typename Compare, typename StatsPolicy>
+template<typename... Args>
+bool RBTMap<Key, Value, Compare, StatsPolicy>::try_emplace(const Key &key,
+                                                        Args&&... args)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
+        bool inserted;
+        emplace_node(key, inserted, std::forward<Args>(args)...);
+        return inserted;
+}
+
+//operator[]
+//Parameters: const Key &key - the key being looked up
+//Returns: Value & - the value stored under the key
+//Does: Returns the value stored under the key, first inserting a
+//      default constructed value if the key is missing
+template<typename Key, typename Value, typename Compare, typename StatsPolicy>
+Value &RBTMap<Key, Value, Compare, StatsPolicy>::operator[](const Key &key)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
+        bool inserted;
+        return emplace_node(key, inserted)->data.value;
+}
+
+//erase function
+//Parameters: const K &key - the key being removed
+//Returns: bool - whether or not the key was stored
+//Does: Removes the key and its value from the map
+template<typename Key, typename Value, typename Compare, typename StatsPolicy>
+template<typename K>
+bool RBTMap<Key, Value, Compare, StatsPolicy>::erase(const K &key)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
+        Node *node = Tree::find_node(key);
+        if (node == nullptr)
+        {
+                return false;
+        }
+        Tree::remove_node(node);
+        num_entries--;
+        return true;
+}
+
+//size function
+//Parameters: Nothing
+//Returns: int - the number of keys stored
+//Does: Returns the number of keys stored in the map
+template<typename Key, typename Value, typename Compare, typename StatsPolicy>
+int RBTMap<Key, Value, Compare, StatsPolicy>::size()
+{
+        return num_entries;
+}
+
+//is_empty function
+//Parameters: Nothing
+//Returns: bool - whether or not the map is empty
+//Does: Checks if the map stores no keys
+template<typename Key, typename Value, typename Compare, typename StatsPolicy>
+bool RBTMap<Key, Value, Compare, StatsPolicy>::is_empty()
+{
+        return num_entries == 0;
+}
+
+//stats function
+//Parameters: Nothing
+//Returns: StatsSnapshot - copy of the counters kept by the StatsPolicy
+//Does: Reports comparisons, rotations, node visits and per operation
+//      latencies (all zero unless the map is built with OpStats)
+template<typename Key, typename Value, typename Compare, typename StatsPolicy>
+StatsSnapshot RBTMap<Key, Value, Compare, StatsPolicy>::stats()
+{
+        return Tree::stats();
+}
+
+//emplace_node function
+//Parameters: const Key &key - the key being looked for
+//            bool &inserted - set to true if a new node was created
+//            Args&&... args - arguments the value is constructed from
+//                             when the key is missing
+//Returns: Node - the node storing the key
+//Does: Walks down the tree once. If the key is found its node is
+//      returned, otherwise a new node is built in place at the slot
+//      the walk ended on and the tree is rebalanced
+template<typename Key, typename Value, typename Compare, typename StatsPolicy>
+template<typename... Args>
+typename RBTMap<Key, Value, Compare, StatsPolicy>::Node *
+RBTMap<Key, Value, Compare, StatsPolicy>::emplace_node(const Key &key,
+                                        bool &inserted, Args&&... args)
+{
+        Node *parent;
+        int cmp;
+        Node *node = Tree::find_slot(key, parent, cmp);
+        inserted = (node == nullptr);
+        if (!inserted)
+        {
+                return node;
+        }
+        node = new Node{MapEntry<Key, Value>(key, std::forward<Args>(args)...),
+                        1, nullptr, nullptr, RED};
+        Tree::attach_node(node, parent, cmp);
+        num_entries++;
+        return node;
+}
\ No newline at end of file
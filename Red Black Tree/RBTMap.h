@@ -0,0 +1,111 @@
+/*
+ *
+ * Red Black Tree Map Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * RBTMap.h
+ * Class Header and Declaration
+ *
+ * Key to value map stored in a single RBT. Each node holds a MapEntry
+ * (key and value together), so find, insert_or_assign, try_emplace and
+ * operator[] all walk the tree once and hand back the value stored in
+ * the node, instead of looking up the key in the tree and then the value
+ * somewhere else.
+ *
+ */
+
+#ifndef RBTMAP_H_
+#define RBTMAP_H_
+
+#include "RBT.h"
+#include <utility>
+
+//key and value stored together in one tree node
+template<typename Key, typename Value>
+struct MapEntry
+{
+        Key key;
+        Value value;
+
+        MapEntry() : key(), value() {}
+        //builds the value in place from the remaining arguments
+        template<typename... Args>
+        MapEntry(const Key &k, Args&&... args)
+                : key(k), value(std::forward<Args>(args)...) {}
+};
+
+//orders MapEntry objects by key, and lets the tree compare a bare key
+//(or anything Compare accepts) against an entry
+template<typename Compare>
+struct EntryCompare
+{
+        typedef void is_transparent;
+
+        Compare compare;
+
+        EntryCompare() : compare() {}
+        EntryCompare(const Compare &comp) : compare(comp) {}
+
+        template<typename Key, typename Value>
+        int operator()(const MapEntry<Key, Value> &a,
+                       const MapEntry<Key, Value> &b) const
+        {
+                return compare(a.key, b.key);
+        }
+        template<typename K, typename Key, typename Value>
+        int operator()(const K &a, const MapEntry<Key, Value> &b) const
+        {
+                return compare(a, b.key);
+        }
+};
+
+template<typename Key, typename Value, typename Compare = ThreeWayCompare,
+         typename StatsPolicy = NoStats>
+class RBTMap : private RBT<MapEntry<Key, Value>, EntryCompare<Compare>,
+                           StatsPolicy>
+{
+        public:
+                //Constructor
+                RBTMap();
+                //Comparator Constructor
+                RBTMap(const Compare &comp);
+                //checks if a key is stored in the map
+                template<typename K>
+                bool contains(const K &key);
+                //returns the value stored under a key
+                template<typename K>
+                Value &find(const K &key);
+                //stores a value under a key, replacing any existing value
+                bool insert_or_assign(const Key &key, const Value &value);
+                //builds a value under a key unless the key is already stored
+                template<typename... Args>
+                bool try_emplace(const Key &key, Args&&... args);
+                //returns the value under a key, inserting a default one
+                Value &operator[](const Key &key);
+                //removes a key and its value
+                template<typename K>
+                bool erase(const K &key);
+                //number of keys stored
+                int size();
+                //checks if the map is empty
+                bool is_empty();
+                //returns a snapshot of the operation counters
+                StatsSnapshot stats();
+        private:
+
+                //the tree the entries are stored in
+                typedef RBT<MapEntry<Key, Value>, EntryCompare<Compare>,
+                            StatsPolicy> Tree;
+                typedef typename Tree::Node Node;
+
+                //number of keys stored
+                int num_entries;
+
+                //finds the node for a key, creating it if it is missing
+                template<typename... Args>
+                Node *emplace_node(const Key &key, bool &inserted,
+                                   Args&&... args);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,510 @@
+/*
+ *
+ * Top-Down Red Black Tree Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * TopDownRBT.cpp
+ * Full function declaration
+ *
+ */
+
+#include "TopDownRBT.h"
+#include <iostream>
+
+using namespace std;
+
+//default constructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Initializes an instance of the Class
+template<typename ElemType, typename Compare, typename StatsPolicy>
+TopDownRBT<ElemType, Compare, StatsPolicy>::TopDownRBT()
+{
+        root = nullptr;
+}
+
+//comparator constructor
+//Parameters: const Compare &comp - the comparator used to order elements
+//Returns: Nothing
+//Does: Initializes an empty instance of the Class that orders its
+//      elements with the passed in comparator
+template<typename ElemType, typename Compare, typename StatsPolicy>
+TopDownRBT<ElemType, Compare, StatsPolicy>::TopDownRBT(const Compare &comp)
+{
+        root = nullptr;
+        compare = comp;
+}
+
+//destructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Deletes all dynamically allocated memory
+template<typename ElemType, typename Compare, typename StatsPolicy>
+TopDownRBT<ElemType, Compare, StatsPolicy>::~TopDownRBT()
+{
+        delete_tree(root);
+}
+
+//copy constructor
+//Parameters: const TopDownRBT &rhs, the tree being copied
+//Returns: Nothing
+//Does: Makes a deep copy of rhs, colors included
+template<typename ElemType, typename Compare, typename StatsPolicy>
+TopDownRBT<ElemType, Compare, StatsPolicy>::TopDownRBT(const TopDownRBT &rhs)
+{
+        compare = rhs.compare;
+        root = copy_tree(rhs.root);
+}
+
+//assignment operator
+//Parameters: const TopDownRBT &rhs, the tree that is being copied
+//            into the current instance
+//Returns: TopDownRBT, the object that copied all data from rhs
+//Does: Frees the current tree and copies rhs into it
+template<typename ElemType, typename Compare, typename StatsPolicy>
+TopDownRBT<ElemType, Compare, StatsPolicy> &TopDownRBT<ElemType, Compare, StatsPolicy>::operator=(const TopDownRBT &rhs)
+{
+        if (this != &rhs)
+        {
+                delete_tree(root);
+                compare = rhs.compare;
+                root = copy_tree(rhs.root);
+        }
+        return *this;
+}
+
+//copy_tree function (private)
+//Parameters: Node *node, the current node being copied
+//Returns: Node, the root of the copy
+//Does: Makes a deep copy of the tree beginning at the passed in node
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename TopDownRBT<ElemType, Compare, StatsPolicy>::Node *TopDownRBT<ElemType, Compare, StatsPolicy>::copy_tree(Node *node)
+{
+        if (node == nullptr)
+        {
+                return nullptr;
+        }
+        Node *temp_node = new Node(*node);
+        temp_node->link[0] = copy_tree(node->link[0]);
+        temp_node->link[1] = copy_tree(node->link[1]);
+        return temp_node;
+}
+
+//delete_tree function (private)
+//Parameters: Node *node, the starting node of the tree being deleted
+//Returns: Nothing
+//Does: Using a post-order traversal, deletes all nodes stored in the tree
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void TopDownRBT<ElemType, Compare, StatsPolicy>::delete_tree(Node *node)
+{
+        if (node == nullptr)
+        {
+                return;
+        }
+        delete_tree(node->link[0]);
+        delete_tree(node->link[1]);
+        delete node;
+}
+
+//contains Function
+//Paramters: const ElemType &element - the value being checked for
+//Returns: bool - whether or not the value is stored in the tree
+//Does: Checks if a passed in value is stored within the tree
+template<typename ElemType, typename Compare, typename StatsPolicy>
+bool TopDownRBT<ElemType, Compare, StatsPolicy>::contains(const ElemType &element)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        Node *node = root;
+        while (node != nullptr)
+        {
+                StatsPolicy::node_visit();
+                int cmp = compare_keys(element, node->data);
+                if (cmp == 0)
+                {
+                        return true;
+                }
+                node = node->link[cmp > 0];
+        }
+        return false;
+}
+
+//contains Function (heterogeneous)
+//Parameters: const Key &key - a value comparable with ElemType
+//Returns: bool - whether or not an equal value is stored in the tree
+//Does: Looks up a key of another type without constructing an
+//      ElemType. Only enabled when Compare declares is_transparent
+template<typename ElemType, typename Compare, typename StatsPolicy>
+template<typename Key, typename C, typename>
+bool TopDownRBT<ElemType, Compare, StatsPolicy>::contains(const Key &key)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        Node *node = root;
+        while (node != nullptr)
+        {
+                StatsPolicy::node_visit();
+                int cmp = compare_keys(key, node->data);
+                if (cmp == 0)
+                {
+                        return true;
+                }
+                node = node->link[cmp > 0];
+        }
+        return false;
+}
+
+//insert function
+//Parameters: ElemType element, element being added to the tree
+//Returns: Nothing
+//Does: Single top-down pass. A black node with two red children is
+//      flipped (it turns red, they turn black) before the walk goes past
+//      it, and if that leaves two reds in a row they are fixed with a
+//      rotation at the grandparent, which the walk still holds. The new
+//      red leaf is then hung where the walk ends, below a black parent
+//      or fixed the same way. A duplicate only bumps its count
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void TopDownRBT<ElemType, Compare, StatsPolicy>::insert(ElemType element)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
+        if (root == nullptr)
+        {
+                root = new_node(element);
+                root->red = 0;
+                return;
+        }
+        //head is a false root whose right child is the tree, so the
+        //root needs no special case when it is rotated
+        Node head;
+        head.red = 0;
+        head.link[0] = nullptr;
+        head.link[1] = root;
+        Node *great = &head;
+        Node *grand = nullptr;
+        Node *parent = nullptr;
+        Node *node = root;
+        int dir = 0;
+        int last = 0;
+        bool inserted = false;
+        while (true)
+        {
+                if (node == nullptr)
+                {
+                        node = new_node(element);
+                        parent->link[dir] = node;
+                        inserted = true;
+                }
+                else if (is_red(node->link[0]) and is_red(node->link[1]))
+                {
+                        node->red = 1;
+                        node->link[0]->red = 0;
+                        node->link[1]->red = 0;
+                }
+                if (is_red(node) and is_red(parent))
+                {
+                        int grand_dir = (great->link[1] == grand);
+                        if (node == parent->link[last])
+                        {
+                                great->link[grand_dir] = single_rotate(grand, !last);
+                        }
+                        else
+                        {
+                                great->link[grand_dir] = double_rotate(grand, !last);
+                        }
+                }
+                StatsPolicy::node_visit();
+                int cmp = compare_keys(element, node->data);
+                if (cmp == 0)
+                {
+                        if (!inserted)
+                        {
+                                node->count++;
+                        }
+                        break;
+                }
+                last = dir;
+                dir = (cmp > 0);
+                if (grand != nullptr)
+                {
+                        great = grand;
+                }
+                grand = parent;
+                parent = node;
+                node = node->link[dir];
+        }
+        root = head.link[1];
+        root->red = 0;
+}
+
+//remove Function
+//Parameters: ElemType element - the value being removed from the tree
+//Returns: bool - whether or not the value was in the tree
+//Does: Single top-down pass that keeps the current node red (or gives
+//      it a red child on the way) by flipping or rotating around its
+//      sibling, so whichever node is finally unlinked is red and no
+//      fixup is needed. The walk continues past the element to its in
+//      order predecessor, which is moved into the element's node before
+//      the predecessor's node is unlinked. Removing one of several
+//      copies only lowers the count; the recoloring done on the way down
+//      leaves a valid tree either way
+template<typename ElemType, typename Compare, typename StatsPolicy>
+bool TopDownRBT<ElemType, Compare, StatsPolicy>::remove(ElemType element)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
+        if (root == nullptr)
+        {
+                return false;
+        }
+        Node head;
+        head.red = 0;
+        head.link[0] = nullptr;
+        head.link[1] = root;
+        Node *node = &head;
+        Node *parent = nullptr;
+        Node *grand = nullptr;
+        Node *found = nullptr;
+        int dir = 1;
+        while (node->link[dir] != nullptr)
+        {
+                int last = dir;
+                grand = parent;
+                parent = node;
+                node = node->link[dir];
+                StatsPolicy::node_visit();
+                int cmp = compare_keys(element, node->data);
+                dir = (cmp > 0);
+                if (cmp == 0)
+                {
+                        found = node;
+                }
+                if (is_red(node) or is_red(node->link[dir]))
+                {
+                        continue;
+                }
+                if (is_red(node->link[!dir]))
+                {
+                        parent->link[last] = single_rotate(node, dir);
+                        parent = parent->link[last];
+                        continue;
+                }
+                Node *sibling = parent->link[!last];
+                if (sibling == nullptr)
+                {
+                        continue;
+                }
+                if (!is_red(sibling->link[0]) and !is_red(sibling->link[1]))
+                {
+                        parent->red = 0;
+                        sibling->red = 1;
+                        node->red = 1;
+                        continue;
+                }
+                int grand_dir = (grand->link[1] == parent);
+                if (is_red(sibling->link[last]))
+                {
+                        grand->link[grand_dir] = double_rotate(parent, last);
+                }
+                else
+                {
+                        grand->link[grand_dir] = single_rotate(parent, last);
+                }
+                Node *top = grand->link[grand_dir];
+                node->red = 1;
+                top->red = 1;
+                top->link[0]->red = 0;
+                top->link[1]->red = 0;
+        }
+        if (found != nullptr)
+        {
+                if (found->count > 1)
+                {
+                        found->count--;
+                }
+                else
+                {
+                        found->data = node->data;
+                        found->count = node->count;
+                        parent->link[parent->link[1] == node] =
+                                node->link[node->link[0] == nullptr];
+                        delete node;
+                }
+        }
+        root = head.link[1];
+        if (root != nullptr)
+        {
+                root->red = 0;
+        }
+        return found != nullptr;
+}
+
+//single_rotate function (private)
+//Parameters: Node *node - root of the subtree being rotated
+//            int dir - 0 to rotate left, 1 to rotate right
+//Returns: Node - the new root of the subtree
+//Does: Lifts the child on the !dir side above node, making the old root
+//      red and the new root black
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename TopDownRBT<ElemType, Compare, StatsPolicy>::Node *TopDownRBT<ElemType, Compare, StatsPolicy>::single_rotate(Node *node, int dir)
+{
+        StatsPolicy::rotation();
+        Node *child = node->link[!dir];
+        node->link[!dir] = child->link[dir];
+        child->link[dir] = node;
+        node->red = 1;
+        child->red = 0;
+        return child;
+}
+
+//double_rotate function (private)
+//Parameters: Node *node - root of the subtree being rotated
+//            int dir - direction of the final rotation
+//Returns: Node - the new root of the subtree
+//Does: Rotates the !dir child the other way first, so its inner child
+//      ends up as the root
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename TopDownRBT<ElemType, Compare, StatsPolicy>::Node *TopDownRBT<ElemType, Compare, StatsPolicy>::double_rotate(Node *node, int dir)
+{
+        node->link[!dir] = single_rotate(node->link[!dir], !dir);
+        return single_rotate(node, dir);
+}
+
+//is_red function (private)
+//Parameters: Node *node - a node or nullptr
+//Returns: bool - true if the node is red
+//Does: Treats null leaves as black
+template<typename ElemType, typename Compare, typename StatsPolicy>
+bool TopDownRBT<ElemType, Compare, StatsPolicy>::is_red(Node *node)
+{
+        return node != nullptr and node->red == 1;
+}
+
+//new_node function (private)
+//Parameters: ElemType element - value stored in the new node
+//Returns: Node - a new red leaf
+//Does: Allocates memory for a new node and initializes its values
+template<typename ElemType, typename Compare, typename StatsPolicy>
+typename TopDownRBT<ElemType, Compare, StatsPolicy>::Node *TopDownRBT<ElemType, Compare, StatsPolicy>::new_node(ElemType element)
+{
+        Node *temp_node = new Node();
+        temp_node->data = element;
+        temp_node->count = 1;
+        temp_node->red = 1;
+        temp_node->link[0] = nullptr;
+        temp_node->link[1] = nullptr;
+        return temp_node;
+}
+
+//tree_height Function
+//Parameters: Nothing
+//Returns: Int - the height of the tree, -1 if it is empty
+//Does: Searches for and returns the height of the tree
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int TopDownRBT<ElemType, Compare, StatsPolicy>::tree_height()
+{
+        return tree_height_recur(root);
+}
+
+//tree_height_recur Function (private)
+//Parameters: Node *node - the root of the tree currently being checked
+//Returns: Int - the height of the current tree, -1 if it is empty
+//Does: Checks and returns the height of the current tree
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int TopDownRBT<ElemType, Compare, StatsPolicy>::tree_height_recur(Node *node)
+{
+        if (node == nullptr)
+        {
+                return -1;
+        }
+        int left_max = tree_height_recur(node->link[0]);
+        int right_max = tree_height_recur(node->link[1]);
+        if (left_max > right_max)
+        {
+                return left_max + 1;
+        }
+        return right_max + 1;
+}
+
+//node_count Function
+//Parameters: Nothing
+//Returns: Int - total node count
+//Does: Returns the total amount of nodes in a tree
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int TopDownRBT<ElemType, Compare, StatsPolicy>::node_count()
+{
+        return node_count_recur(root);
+}
+
+//node_count_recur Function (private)
+//Parameters: Node *node - the root of the tree currently being checked
+//Returns: Int - the number of nodes in the current tree
+//Does: Counts the nodes in the tree starting at the passed in node
+template<typename ElemType, typename Compare, typename StatsPolicy>
+int TopDownRBT<ElemType, Compare, StatsPolicy>::node_count_recur(Node *node)
+{
+        if (node == nullptr)
+        {
+                return 0;
+        }
+        return node_count_recur(node->link[0]) + node_count_recur(node->link[1]) + 1;
+}
+
+//print_tree function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: prints all elements within the tree in order
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void TopDownRBT<ElemType, Compare, StatsPolicy>::print_tree()
+{
+        in_order_print(root);
+        cout << endl;
+}
+
+//in_order_print function (private)
+//Parameters: Node *node, the root of the tree
+//Returns: Nothing
+//Does: Prints the contents of the tree using an in-order traversal
+template<typename ElemType, typename Compare, typename StatsPolicy>
+void TopDownRBT<ElemType, Compare, StatsPolicy>::in_order_print(Node *node)
+{
+        if (node == nullptr)
+        {
+                return;
+        }
+        in_order_print(node->link[0]);
+        cout << node->data << " ";
+        in_order_print(node->link[1]);
+}
+
+//stats function
+//Parameters: Nothing
+//Returns: StatsSnapshot - copy of the counters kept by the StatsPolicy
+//Does: Reports comparisons, rotations, node visits and per operation
+//      latencies (all zero unless the tree is built with OpStats)
+template<typename ElemType, typename Compare, typename StatsPolicy>
+StatsSnapshot TopDownRBT<ElemType, Compare, StatsPolicy>::stats()
+{
+        return StatsPolicy::snapshot();
+}
+
+//memory_usage function
+//Parameters: Nothing
+//Returns: size_t - bytes used by the nodes
+//Does: Multiplies the node count by the node size
+template<typename ElemType, typename Compare, typename StatsPolicy>
+size_t TopDownRBT<ElemType, Compare, StatsPolicy>::memory_usage()
+{
+        return node_count() * sizeof(Node);
+}
+
+//compare_keys function (private)
+//Parameters: const A &a, const B &b - keys being compared
+//Returns: int - negative if a orders before b, zero if they are equal,
+//         positive if a orders after b
+//Does: Compares two keys with the tree's comparator, counting the
+//      comparison
+template<typename ElemType, typename Compare, typename StatsPolicy>
+template<typename A, typename B>
+int TopDownRBT<ElemType, Compare, StatsPolicy>::compare_keys(const A &a, const B &b)
+{
+        StatsPolicy::comparison();
+        return compare(a, b);
+}
\ No newline at end of file
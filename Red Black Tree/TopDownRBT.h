@@ -0,0 +1,105 @@
+/*
+ *
+ * Top-Down Red Black Tree Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * TopDownRBT.h
+ * Class Header and Declaration
+ *
+ * Red black tree whose insert and remove fix the colors on the way down
+ * in a single pass, so nodes need no parent pointer. Insert splits any
+ * node with two red children before stepping past it, and remove pushes
+ * a red node down ahead of itself so the node finally unlinked is red.
+ * Only the current node, its parent, grandparent and great grandparent
+ * are ever being changed, which also suits lock coupling. The color
+ * shares an int with the duplicate count, so an int node is 24 bytes
+ * against 32 for RBT.
+ *
+ */
+
+#ifndef TOPDOWNRBT_H_
+#define TOPDOWNRBT_H_
+
+#include "../Comparators/ThreeWayCompare.h"
+#include "../Instrumentation/OpStats.h"
+
+#include <cstddef>
+
+template<typename ElemType, typename Compare = ThreeWayCompare,
+         typename StatsPolicy = NoStats>
+class TopDownRBT : private StatsPolicy
+{
+        public:
+                //Constructor
+                TopDownRBT();
+                //Comparator Constructor
+                TopDownRBT(const Compare &comp);
+                //Destructor
+                ~TopDownRBT();
+                //Copy Constructor
+                TopDownRBT(const TopDownRBT &rhs);
+                //Assignment Operator
+                TopDownRBT &operator=(const TopDownRBT &rhs);
+                //checks if an element is stored in the tree
+                bool contains(const ElemType &element);
+                //checks if an element equal to the key is stored, without
+                //converting the key to an ElemType (transparent Compare only)
+                template<typename Key, typename C = Compare,
+                         typename = typename C::is_transparent>
+                bool contains(const Key &key);
+                //inserts an element
+                void insert(ElemType element);
+                //removes an element
+                bool remove(ElemType element);
+                //Checks the height of the tree
+                int tree_height();
+                //Counts number of nodes
+                int node_count();
+                //prints values stored in the tree
+                void print_tree();
+                //returns a snapshot of the operation counters
+                StatsSnapshot stats();
+                //returns the bytes held by the tree's nodes
+                size_t memory_usage();
+
+        private:
+
+                //struct to store node information, link[0] is the left
+                //child and link[1] the right so both sides share one code
+                //path
+                struct Node
+                {
+                        ElemType data;
+                        unsigned int count : 31;
+                        unsigned int red : 1;
+                        Node *link[2];
+                };
+                //root of the tree
+                Node *root;
+                //orders the elements
+                Compare compare;
+                //creates a deep copy of a tree
+                Node *copy_tree(Node *node);
+                //removes all nodes from a tree
+                void delete_tree(Node *node);
+                //creates and allocates memory for a new red node
+                Node *new_node(ElemType element);
+                //true if a node is red, null leaves are black
+                bool is_red(Node *node);
+                //rotates node toward dir and recolors the pair
+                Node *single_rotate(Node *node, int dir);
+                //rotates node's child away from dir, then node toward dir
+                Node *double_rotate(Node *node, int dir);
+                //finds the height of a tree starting at the passed in node
+                int tree_height_recur(Node *node);
+                //counts the number of nodes starting at the passed in node
+                int node_count_recur(Node *node);
+                //in order traversal print
+                void in_order_print(Node *node);
+                //three way comparison of two keys, counting the comparison
+                template<typename A, typename B>
+                int compare_keys(const A &a, const B &b);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,133 @@
+/*
+ *
+ * Aggregate Stack Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * AggregateStack.cpp
+ * Full function implementation
+ *
+ */
+
+#include "AggregateStack.h"
+#include "Stack.cpp"
+
+using namespace std;
+
+//is_empty function
+//Parameters: Nothing
+//Returns: bool
+//Does: Checks if the Stack object is empty
+template<typename ElemType, typename Monoid, int InlineCapacity, typename StatsPolicy>
+bool AggregateStack<ElemType, Monoid, InlineCapacity, StatsPolicy>::is_empty()
+{
+        return items.is_empty();
+}
+
+//size function
+//Parameters: Nothing
+//Returns: int
+//Does: Returns the number of items in the Stack
+template<typename ElemType, typename Monoid, int InlineCapacity, typename StatsPolicy>
+int AggregateStack<ElemType, Monoid, InlineCapacity, StatsPolicy>::size()
+{
+        return items.size();
+}
+
+//top function
+//Parameters: Nothing
+//Returns: ElemType
+//Does: Returns the top element on the Stack
+template<typename ElemType, typename Monoid, int InlineCapacity, typename StatsPolicy>
+ElemType AggregateStack<ElemType, Monoid, InlineCapacity, StatsPolicy>::top()
+{
+        return items.top();
+}
+
+//push function
+//Parameters: ElemType element, item added to the Stack
+//Returns: Nothing
+//Does: Adds an element to the top of the stack along with the aggregate
+//      of the new element and the summary below it
+template<typename ElemType, typename Monoid, int InlineCapacity, typename StatsPolicy>
+void AggregateStack<ElemType, Monoid, InlineCapacity, StatsPolicy>::push(ElemType element)
+{
+        if (summaries.is_empty())
+        {
+                summaries.push(Monoid::lift(element));
+        }
+        else
+        {
+                summaries.push(Monoid::combine(summaries.top(),
+                                               Monoid::lift(element)));
+        }
+        items.push(element);
+}
+
+//pop function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Removes the top element and its summary from the Stack
+template<typename ElemType, typename Monoid, int InlineCapacity, typename StatsPolicy>
+void AggregateStack<ElemType, Monoid, InlineCapacity, StatsPolicy>::pop()
+{
+        items.pop();
+        summaries.pop();
+}
+
+//aggregate function
+//Parameters: Nothing
+//Returns: Value - the aggregate of every element in the Stack
+//Does: Returns the top summary, throws if the Stack is empty
+template<typename ElemType, typename Monoid, int InlineCapacity, typename StatsPolicy>
+typename AggregateStack<ElemType, Monoid, InlineCapacity, StatsPolicy>::Value
+AggregateStack<ElemType, Monoid, InlineCapacity, StatsPolicy>::aggregate()
+{
+        if (summaries.is_empty())
+        {
+                throw runtime_error("Cannot aggregate "
+                                        "empty Stack");
+        }
+        return summaries.top();
+}
+
+//min function
+//Parameters: Nothing
+//Returns: ElemType - the smallest element in the Stack
+//Does: Reads the minimum from the aggregate (MinMaxSum only)
+template<typename ElemType, typename Monoid, int InlineCapacity, typename StatsPolicy>
+ElemType AggregateStack<ElemType, Monoid, InlineCapacity, StatsPolicy>::min()
+{
+        return aggregate().min;
+}
+
+//max function
+//Parameters: Nothing
+//Returns: ElemType - the largest element in the Stack
+//Does: Reads the maximum from the aggregate (MinMaxSum only)
+template<typename ElemType, typename Monoid, int InlineCapacity, typename StatsPolicy>
+ElemType AggregateStack<ElemType, Monoid, InlineCapacity, StatsPolicy>::max()
+{
+        return aggregate().max;
+}
+
+//sum function
+//Parameters: Nothing
+//Returns: ElemType - the sum of the elements in the Stack
+//Does: Reads the sum from the aggregate (MinMaxSum only)
+template<typename ElemType, typename Monoid, int InlineCapacity, typename StatsPolicy>
+ElemType AggregateStack<ElemType, Monoid, InlineCapacity, StatsPolicy>::sum()
+{
+        return aggregate().sum;
+}
+
+//stats function
+//Parameters: Nothing
+//Returns: StatsSnapshot - copy of the counters kept for the elements
+//Does: Reports reallocations and per operation latencies of the element
+//      storage (all zero unless the Stack is built with OpStats)
+template<typename ElemType, typename Monoid, int InlineCapacity, typename StatsPolicy>
+StatsSnapshot AggregateStack<ElemType, Monoid, InlineCapacity, StatsPolicy>::stats()
+{
+        return items.stats();
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+/*
+ *
+ * Aggregate Stack Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * AggregateStack.h
+ * Header and function declarations
+ *
+ * Stack that keeps, next to every element, the aggregate of that element
+ * and everything below it. Popping just drops the top summary, so the
+ * aggregate of the whole stack is always the top summary and costs O(1)
+ * to read. The aggregate is any associative Monoid; MinMaxSum (running
+ * minimum, maximum and sum) is the default.
+ *
+ */
+
+#ifndef AGGREGATESTACK_H_
+#define AGGREGATESTACK_H_
+
+#include "Stack.h"
+
+//default monoid, tracks the minimum, maximum and sum of the elements
+template<typename ElemType>
+struct MinMaxSum
+{
+        //summary of a run of elements
+        struct Value
+        {
+                ElemType min;
+                ElemType max;
+                ElemType sum;
+        };
+
+        //summary of a single element
+        static Value lift(const ElemType &element)
+        {
+                Value value;
+                value.min = value.max = value.sum = element;
+                return value;
+        }
+
+        //summary of the elements below followed by the elements above
+        static Value combine(const Value &below, const Value &above)
+        {
+                Value value;
+                value.min = above.min < below.min ? above.min : below.min;
+                value.max = below.max < above.max ? above.max : below.max;
+                value.sum = below.sum + above.sum;
+                return value;
+        }
+};
+
+//Monoid must provide a Value type, static Value lift(const ElemType &) and
+//an associative static Value combine(const Value &below, const Value &above)
+template<typename ElemType, typename Monoid = MinMaxSum<ElemType>,
+         int InlineCapacity = 0, typename StatsPolicy = NoStats>
+class AggregateStack
+{
+        public:
+                //type of the aggregate kept for the stack
+                typedef typename Monoid::Value Value;
+
+                //checks if stack is empty
+                bool is_empty();
+                //returns the number of items stored in the stack
+                int size();
+                //returns the top element of the stack
+                ElemType top();
+                //adds an element to the top of the stack
+                void push(ElemType element);
+                //removes top element from the stack
+                void pop();
+                //returns the aggregate of every element in the stack
+                Value aggregate();
+                //returns the smallest element (MinMaxSum only)
+                ElemType min();
+                //returns the largest element (MinMaxSum only)
+                ElemType max();
+                //returns the sum of the elements (MinMaxSum only)
+                ElemType sum();
+                //returns a snapshot of the operation counters
+                StatsSnapshot stats();
+
+        private:
+
+                //the elements themselves
+                Stack<ElemType, InlineCapacity, StatsPolicy> items;
+                //summaries[i] is the aggregate of items 0 through i
+                Stack<Value, InlineCapacity> summaries;
+};
+
+#endif
\ No newline at end of file
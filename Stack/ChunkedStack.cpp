@@ -0,0 +1,236 @@
+/*
+ *
+ * Chunked Stack Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * ChunkedStack.cpp
+ * Full function implementation
+ *
+ */
+
+#include "ChunkedStack.h"
+
+#include <stdexcept>
+
+using namespace std;
+
+//default constructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Initializes an empty stack, no chunk is allocated until the first
+//      push
+template<typename ElemType, int ChunkSize, typename StatsPolicy>
+ChunkedStack<ElemType, ChunkSize, StatsPolicy>::ChunkedStack()
+{
+        top_chunk = spare = nullptr;
+        top_count = num_items = 0;
+}
+
+//destructor
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Deletes all dynamically allocated memory
+template<typename ElemType, int ChunkSize, typename StatsPolicy>
+ChunkedStack<ElemType, ChunkSize, StatsPolicy>::~ChunkedStack()
+{
+        delete_chunks();
+}
+
+//copy constructor
+//Parameters: const ChunkedStack &rhs, second instance of the
+//            ChunkedStack class
+//Returns: Nothing
+//Does: Creates new instance of the ChunkedStack Class and copies
+//      the values stored in object passed in
+template<typename ElemType, int ChunkSize, typename StatsPolicy>
+ChunkedStack<ElemType, ChunkSize, StatsPolicy>::ChunkedStack(const ChunkedStack &rhs)
+{
+        copy_chunks(rhs);
+}
+
+//assignment operator
+//Parameters: const ChunkedStack &rhs, second instance of the
+//            ChunkedStack class
+//Returns: ChunkedStack, the object that copied all data from rhs
+//Does: Copies all values stored in the passed in object into the
+//      current object
+template<typename ElemType, int ChunkSize, typename StatsPolicy>
+ChunkedStack<ElemType, ChunkSize, StatsPolicy> &ChunkedStack<ElemType, ChunkSize, StatsPolicy>::operator=(const ChunkedStack &rhs)
+{
+        if (this == &rhs)
+        {
+                return *this;
+        }
+        delete_chunks();
+        copy_chunks(rhs);
+        return *this;
+}
+
+//is_empty function
+//Parameters: Nothing
+//Returns: bool
+//Does: Checks if the ChunkedStack object is empty
+template<typename ElemType, int ChunkSize, typename StatsPolicy>
+bool ChunkedStack<ElemType, ChunkSize, StatsPolicy>::is_empty()
+{
+        return num_items == 0;
+}
+
+//size function
+//Parameters: Nothing
+//Returns: int
+//Does: Returns the number of items in the ChunkedStack
+template<typename ElemType, int ChunkSize, typename StatsPolicy>
+int ChunkedStack<ElemType, ChunkSize, StatsPolicy>::size()
+{
+        return num_items;
+}
+
+//top function
+//Parameters: Nothing
+//Returns: ElemType
+//Does: Returns the top element, the last one in the top chunk
+template<typename ElemType, int ChunkSize, typename StatsPolicy>
+ElemType ChunkedStack<ElemType, ChunkSize, StatsPolicy>::top()
+{
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        if (num_items < 1)
+        {
+                throw runtime_error("Cannot get top of "
+                                        "empty Stack");
+        }
+        return top_chunk->items[top_count-1];
+}
+
+//push function
+//Parameters: ElemType element, item added to the ChunkedStack
+//Returns: Nothing
+//Does: Adds an element to the top of the stack, linking a new chunk
+//      first when the top one is full
+template<typename ElemType, int ChunkSize, typename StatsPolicy>
+void ChunkedStack<ElemType, ChunkSize, StatsPolicy>::push(ElemType element)
+{
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
+        if (top_chunk == nullptr or top_count == ChunkSize)
+        {
+                push_chunk();
+        }
+        top_chunk->items[top_count] = element;
+        top_count++;
+        num_items++;
+}
+
+//pop function
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Removes the top element, and the top chunk with it once the
+//      chunk is empty and there is a chunk below it
+template<typename ElemType, int ChunkSize, typename StatsPolicy>
+void ChunkedStack<ElemType, ChunkSize, StatsPolicy>::pop()
+{
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
+        if (num_items < 1)
+        {
+                throw runtime_error("Cannot pop from "
+                                        "empty Stack");
+        }
+        top_count--;
+        num_items--;
+        if (top_count == 0 and top_chunk->below != nullptr)
+        {
+                pop_chunk();
+        }
+}
+
+//stats function
+//Parameters: Nothing
+//Returns: StatsSnapshot - copy of the counters kept by the StatsPolicy
+//Does: Reports chunk allocations (as reallocations) and per operation
+//      latencies (all zero unless the Stack is built with OpStats)
+template<typename ElemType, int ChunkSize, typename StatsPolicy>
+StatsSnapshot ChunkedStack<ElemType, ChunkSize, StatsPolicy>::stats()
+{
+        return StatsPolicy::snapshot();
+}
+
+//push_chunk function (private)
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Links an empty chunk on top of the current one. The spare is
+//      used when there is one, otherwise a chunk is allocated
+template<typename ElemType, int ChunkSize, typename StatsPolicy>
+void ChunkedStack<ElemType, ChunkSize, StatsPolicy>::push_chunk()
+{
+        Chunk *chunk = spare;
+        if (chunk == nullptr)
+        {
+                StatsPolicy::reallocation();
+                chunk = new Chunk;
+        }
+        spare = nullptr;
+        chunk->below = top_chunk;
+        top_chunk = chunk;
+        top_count = 0;
+}
+
+//pop_chunk function (private)
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Unlinks the empty top chunk and makes the chunk below it, which
+//      is full, the top. The unlinked chunk becomes the spare; any
+//      older spare is freed, so at most one empty chunk is held
+template<typename ElemType, int ChunkSize, typename StatsPolicy>
+void ChunkedStack<ElemType, ChunkSize, StatsPolicy>::pop_chunk()
+{
+        Chunk *chunk = top_chunk;
+        top_chunk = chunk->below;
+        top_count = ChunkSize;
+        delete spare;
+        spare = chunk;
+}
+
+//copy_chunks function (private)
+//Parameters: const ChunkedStack &rhs, the stack being copied
+//Returns: Nothing
+//Does: Copies rhs chunk by chunk from the top down, so the copy has the
+//      same layout. The spare is not copied
+template<typename ElemType, int ChunkSize, typename StatsPolicy>
+void ChunkedStack<ElemType, ChunkSize, StatsPolicy>::copy_chunks(const ChunkedStack &rhs)
+{
+        top_chunk = spare = nullptr;
+        top_count = rhs.top_count;
+        num_items = rhs.num_items;
+        Chunk **link = &top_chunk;
+        int count = rhs.top_count;
+        for (Chunk *from = rhs.top_chunk; from != nullptr; from = from->below)
+        {
+                Chunk *chunk = new Chunk;
+                for (int i = 0; i < count; i++)
+                {
+                        chunk->items[i] = from->items[i];
+                }
+                *link = chunk;
+                link = &chunk->below;
+                count = ChunkSize;
+        }
+        *link = nullptr;
+}
+
+//delete_chunks function (private)
+//Parameters: Nothing
+//Returns: Nothing
+//Does: Deletes every chunk in the stack and the spare
+template<typename ElemType, int ChunkSize, typename StatsPolicy>
+void ChunkedStack<ElemType, ChunkSize, StatsPolicy>::delete_chunks()
+{
+        while (top_chunk != nullptr)
+        {
+                Chunk *below = top_chunk->below;
+                delete top_chunk;
+                top_chunk = below;
+        }
+        delete spare;
+        spare = nullptr;
+        top_count = num_items = 0;
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+/*
+ *
+ * Chunked Stack Reimplementation
+ * Author: Alec Xu
+ * Last Motified: October 19, 2026
+ *
+ * ChunkedStack.h
+ * Header and function declarations
+ *
+ * Stack stored as a linked list of fixed size chunks of ChunkSize
+ * elements, newest chunk on top. Growing links one more chunk instead of
+ * copying every element into a bigger array, so the worst push costs one
+ * chunk allocation rather than O(n), and an element never moves while it
+ * is on the stack. The last chunk emptied by pop is kept as a spare and
+ * handed to the next push that needs a chunk, so a stack going back and
+ * forth across a chunk boundary does not allocate and free on every
+ * crossing.
+ *
+ */
+
+#ifndef CHUNKEDSTACK_H_
+#define CHUNKEDSTACK_H_
+
+#include "../Instrumentation/OpStats.h"
+
+template<typename ElemType, int ChunkSize = 256,
+         typename StatsPolicy = NoStats>
+class ChunkedStack : private StatsPolicy
+{
+        public:
+                //default constructor
+                ChunkedStack();
+                //destructor
+                ~ChunkedStack();
+                //copy constructor
+                ChunkedStack(const ChunkedStack &rhs);
+                //assignement operator
+                ChunkedStack &operator=(const ChunkedStack &rhs);
+                //checks if stack is empty
+                bool is_empty();
+                //returns the number of items stored in the stack
+                int size();
+                //returns the top element of the stack
+                ElemType top();
+                //adds an element to the top of the stack
+                void push(ElemType element);
+                //removes top element from the stack
+                void pop();
+                //returns a snapshot of the operation counters
+                StatsSnapshot stats();
+
+        private:
+
+                static_assert(ChunkSize > 0, "ChunkSize must be positive");
+
+                //block of elements, below points at the chunk under it
+                struct Chunk
+                {
+                        ElemType items[ChunkSize];
+                        Chunk *below;
+                };
+
+                //chunk holding the top element, nullptr until the first
+                //push
+                Chunk *top_chunk;
+                //number of elements in top_chunk
+                int top_count;
+                //number of items in the stack
+                int num_items;
+                //emptied chunk kept for the next push that needs one
+                Chunk *spare;
+
+                //puts a chunk on top, reusing the spare if there is one
+                void push_chunk();
+                //takes the empty top chunk off, keeping it as the spare
+                void pop_chunk();
+                //copies another stack's chunks
+                void copy_chunks(const ChunkedStack &rhs);
+                //deletes every chunk, including the spare
+                void delete_chunks();
+};
+
+#endif
\ No newline at end of file
@@ -9,30 +9,34 @@
  * 
  */
 
+#ifndef STACK_CPP_
+#define STACK_CPP_
+
 #include "Stack.h"
 #include <iostream>
 
+using namespace std;
+
 //default constructor
 //Parameters: Nothing
 //Returns: Nothing
 //Does: Initializes an instance of the class
-template<typename ElemType>
-Stack<ElemType>::Stack()
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+Stack<ElemType, InlineCapacity, StatsPolicy>::Stack()
 {
-        array = nullptr;
         num_items = 0;
-        max_capacity = 0;
+        init_storage(0);
 }
 
 //destructor
 //Parameters: Nothing
 //Returns: Nothing
 //Does: Deletes all dynamically allocated memory
-template<typename ElemType>
-Stack<ElemType>::~Stack()
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+Stack<ElemType, InlineCapacity, StatsPolicy>::~Stack()
 {
         num_items = max_capacity = -1;
-        delete [] array;
+        release_storage();
         array = nullptr;
 }
 
@@ -42,12 +46,11 @@ Stack<ElemType>::~Stack()
 //Returns: Nothing
 //Does: Creates new instance of the Stack Class and copies
 //      the values stored in object passed in
-template<typename ElemType>
-Stack<ElemType>::Stack(const Stack &rhs)
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+Stack<ElemType, InlineCapacity, StatsPolicy>::Stack(const Stack &rhs)
 {
         num_items = rhs.num_items;
-        array = new ElemType[num_items];
-        max_capacity = num_items;
+        init_storage(num_items);
         copy_array(rhs.array, array, num_items);
 }
 
@@ -57,17 +60,20 @@ Stack<ElemType>::Stack(const Stack &rhs)
 //Returns: Nothing
 //Does: Copies all values stored in the passed in object into the
 //      current object
-template<typename ElemType>
-Stack<ElemType> &Stack<ElemType>::operator=(const Stack &rhs)
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+Stack<ElemType, InlineCapacity, StatsPolicy> &
+Stack<ElemType, InlineCapacity, StatsPolicy>::operator=(const Stack &rhs)
 {
         if (this == &rhs)
         {
                 return *this;
         }
+        if (rhs.num_items > max_capacity)
+        {
+                release_storage();
+                init_storage(rhs.num_items);
+        }
         num_items = rhs.num_items;
-        max_capacity = rhs.max_capacity;
-        delete [] array;
-        array = new ElemType[max_capacity];
         copy_array(rhs.array, array, num_items);
         return *this;
 }
@@ -76,8 +82,8 @@ Stack<ElemType> &Stack<ElemType>::operator=(const Stack &rhs)
 //Parameters: Nothing
 //Returns: bool
 //Does: Checks if the Stack object is empty
-template<typename ElemType>
-bool Stack<ElemType>::is_empty()
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+bool Stack<ElemType, InlineCapacity, StatsPolicy>::is_empty()
 {
         if (num_items == 0)
         {
@@ -90,8 +96,8 @@ bool Stack<ElemType>::is_empty()
 //Parameters: Nothing
 //Returns: int
 //Does: Returns the number of items in the Stack
-template<typename ElemType>
-int Stack<ElemType>::size()
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+int Stack<ElemType, InlineCapacity, StatsPolicy>::size()
 {
         return num_items;
 }
@@ -99,62 +105,72 @@ int Stack<ElemType>::size()
 //top function
 //Parameters: Nothing
 //Returns: ElemType
-//Does: Returns the top element on the Stack
-template<typename ElemType>
-ElemType Stack<ElemType>::top()
+//Does: Returns the top element on the Stack, which is kept at the
+//      back of the array so push and pop never shift
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+ElemType Stack<ElemType, InlineCapacity, StatsPolicy>::top()
 {
-        return array[0];
+        typename StatsPolicy::Timer timer(*this, STAT_LOOKUP);
+        if (num_items < 1)
+        {
+                throw runtime_error("Cannot get top of "
+                                        "empty Stack");
+        }
+        return array[num_items-1];
 }
 
 //push function
 //Parameters: ElemType element, item added to the Stack
 //Returns: Nothing
 //Does: Adds an element to the top of the stack
-template<typename ElemType>
-void Stack<ElemType>::push(ElemType element)
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void Stack<ElemType, InlineCapacity, StatsPolicy>::push(ElemType element)
 {
+        typename StatsPolicy::Timer timer(*this, STAT_INSERT);
         ensure_capacity(num_items+1);
-        shift_right(num_items,0);
-        array[0] = element;
+        array[num_items] = element;
         num_items++;
 }
 
 //pop function
 //Parameters: Nothing
 //Returns: Nothing
-//Does: Removes the first element from the Stack
-template<typename ElemType>
-void Stack<ElemType>::pop()
+//Does: Removes the top element from the Stack
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void Stack<ElemType, InlineCapacity, StatsPolicy>::pop()
 {
+        typename StatsPolicy::Timer timer(*this, STAT_REMOVE);
         if (num_items < 1)
         {
                 throw runtime_error("Cannot pop from " 
                                         "empty Stack");
         }
-        shift_left(0,num_items-1);
         num_items--;
 }
 
 //ensure_capacity function
 //Parameters: int desired_capacity, amount of memory needed
 //Returns: Nothing
-//Does: Checks if Stack has the desired memory allocation
-template<typename ElemType>
-void Stack<ElemType>::ensure_capacity(int desired_capacity)
+//Does: Checks if Stack has the desired memory allocation, doubling
+//      the heap array when it does not
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void Stack<ElemType, InlineCapacity, StatsPolicy>::ensure_capacity(int desired_capacity)
 {
-        if (num_items > desired_capacity)
+        if (desired_capacity <= max_capacity)
         {
                 return;
         }
-        ElemType *new_array = NULL;
-        new_array = new ElemType[desired_capacity];
-        max_capacity = desired_capacity;
-        for (int i = 0; i < num_items; i++)
+        if (desired_capacity < 2 * max_capacity)
         {
-                new_array[i] = array[i];
+                desired_capacity = 2 * max_capacity;
         }
-        delete [] array;
+        StatsPolicy::reallocation();
+        ElemType *new_array = NULL;
+        new_array = new ElemType[desired_capacity];
+        copy_array(array, new_array, num_items);
+        release_storage();
         array = new_array;
+        max_capacity = desired_capacity;
 }
 
 //copy_array function
@@ -163,40 +179,54 @@ void Stack<ElemType>::ensure_capacity(int desired_capacity)
 //            int length, the length of the array 
 //Returns: Nothing
 //Does: Copies the contents of an array from one to another
-template<typename ElemType>
-void Stack<ElemType>::copy_array(ElemType from[], 
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void Stack<ElemType, InlineCapacity, StatsPolicy>::copy_array(ElemType from[],
                                         ElemType to[], int length)
 {
         for (int i = 0; i < length; ++i)
                 to[i] = from[i];
 }
 
-//shift_right function
-//Parameters: int being, index of the beginning of the shift
-//            int end, index of the end of the shift
+//init_storage function
+//Parameters: int capacity, number of elements the storage must hold
 //Returns: Nothing
-//Does: Shifts elements to the right from the begin index
-//      to the end index
-template<typename ElemType>
-void Stack<ElemType>::shift_right(int begin, int end)
+//Does: Uses the inline array when the capacity fits in it, otherwise
+//      allocates a heap array of exactly the given capacity
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void Stack<ElemType, InlineCapacity, StatsPolicy>::init_storage(int capacity)
 {
-        for (int i = begin; i > end; i--)
+        if (capacity <= InlineCapacity)
         {
-                array[i] = array[i-1];
+                array = inline_array;
+                max_capacity = InlineCapacity;
+                return;
         }
+        array = new ElemType[capacity];
+        max_capacity = capacity;
 }
 
-//shift_left function
-//Parameters: int begin, index of the beginning of the shift
-//            int end, index of the end of the shift
+//release_storage function
+//Parameters: Nothing
 //Returns: Nothing
-//Does: Shifts elements to the left within the bounds 
-//      passed into the function
-template<typename ElemType>
-void Stack<ElemType>::shift_left(int begin, int end)
+//Does: Deletes the array unless it is the inline array
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+void Stack<ElemType, InlineCapacity, StatsPolicy>::release_storage()
 {
-        for (int i = begin; i < end; i++)
+        if (array != inline_array)
         {
-                array[i] = array[i+1];
+                delete [] array;
         }
-}
\ No newline at end of file
+}
+
+//stats function
+//Parameters: Nothing
+//Returns: StatsSnapshot - copy of the counters kept by the StatsPolicy
+//Does: Reports reallocations and per operation latencies (all zero
+//      unless the Stack is built with OpStats)
+template<typename ElemType, int InlineCapacity, typename StatsPolicy>
+StatsSnapshot Stack<ElemType, InlineCapacity, StatsPolicy>::stats()
+{
+        return StatsPolicy::snapshot();
+}
+
+#endif
\ No newline at end of file
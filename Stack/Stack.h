@@ -12,8 +12,13 @@
 #ifndef STACK_H_
 #define STACK_H_
 
-template<typename ElemType>
-class Stack
+#include "../Instrumentation/OpStats.h"
+
+//InlineCapacity elements are stored inside the Stack object itself, so
+//stacks that never grow past it never touch the heap
+template<typename ElemType, int InlineCapacity = 0,
+         typename StatsPolicy = NoStats>
+class Stack : private StatsPolicy
 {
         public:
                 //default constructor
@@ -34,11 +39,16 @@ class Stack
                 void push(ElemType element);
                 //removes top element from the stack
                 void pop();
+                //returns a snapshot of the operation counters
+                StatsSnapshot stats();
 
         private:
 
-                //array to store data
+                //array to store data, points at inline_array until the
+                //stack outgrows it
                 ElemType *array;
+                //in-object storage for the first InlineCapacity elements
+                ElemType inline_array[InlineCapacity > 0 ? InlineCapacity : 1];
                 //number of items in the stack
                 int num_items;
                 //maximum number Stack is able to store
@@ -48,10 +58,10 @@ class Stack
                 void ensure_capacity(int desired_capacity);
                 //copies one array into another
                 void copy_array(ElemType from[], ElemType to[], int length);
-                //shifts elements to the right from one index to antoher
-                void shift_right(int begin, int end);
-                //shift elements to the left from one index to another
-                void shift_left(int begin, int end);
+                //points array at storage able to hold the given capacity
+                void init_storage(int capacity);
+                //frees the array if it lives on the heap
+                void release_storage();
 };
 
 #endif 
\ No newline at end of file